@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <fmt/compile.h>
+#include <fmt/format.h>
+#include <nanobench.h>
+
+#include "./benchmark_helpers.hpp"
+#include "stronk/extensions/fmt.hpp"
+#include "stronk/stronk.hpp"
+#include "stronk/unit.hpp"
+#include "stronk/utilities/ratio.hpp"
+
+namespace
+{
+
+struct a_custom_formatted_type
+    : twig::stronk<a_custom_formatted_type, double, twig::can_fmt_format_builder<"{:.2f} MWh">::skill>
+{
+    using stronk::stronk;
+};
+
+void benchmark_custom_format(ankerl::nanobench::Bench& bench, size_t size)
+{
+    auto values = std::vector<a_custom_formatted_type>(size);
+    std::ranges::generate(values, []() { return generate_randomish<a_custom_formatted_type> {}(); });
+    auto out = fmt::memory_buffer {};
+
+    bench.batch(size).run("fmt::format_to of the underlying values",
+                          [&values, &out]()
+                          {
+                              out.clear();
+                              for (const auto& value : values) {
+                                  fmt::format_to(fmt::appender(out),
+                                                 FMT_COMPILE("{:.2f} MWh\n"),
+                                                 value.unwrap<a_custom_formatted_type>());
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(out);
+                          });
+    bench.batch(size).run("fmt::format_to of a_custom_formatted_type",
+                          [&values, &out]()
+                          {
+                              out.clear();
+                              for (const auto& value : values) {
+                                  fmt::format_to(fmt::appender(out), "{}\n", value);
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(out);
+                          });
+    bench.batch(size).run("fmt::format_to of a_custom_formatted_type with a width",
+                          [&values, &out]()
+                          {
+                              out.clear();
+                              for (const auto& value : values) {
+                                  fmt::format_to(fmt::appender(out), "{:>16}\n", value);
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(out);
+                          });
+}
+
+struct a_watt_hours_unit : twig::stronk_default_unit<a_watt_hours_unit, twig::ratio<1>>
+{
+    constexpr static std::string_view symbol = "Wh";
+};
+
+void benchmark_unit_symbol_format(ankerl::nanobench::Bench& bench, size_t size)
+{
+    using mega_watt_hours_t = a_watt_hours_unit::scaled_t<twig::mega>::value<double>;
+    auto values = std::vector<mega_watt_hours_t>(size);
+    std::ranges::generate(values, []() { return generate_randomish<mega_watt_hours_t> {}(); });
+    auto out = fmt::memory_buffer {};
+
+    bench.batch(size).run("fmt::format_to with a symbol built at runtime",
+                          [&values, &out]()
+                          {
+                              out.clear();
+                              for (const auto& value : values) {
+                                  const auto symbol = std::string {"M"} + std::string {"Wh"};
+                                  fmt::format_to(
+                                      fmt::appender(out), "{} {}\n", value.unwrap<mega_watt_hours_t>(), symbol);
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(out);
+                          });
+    bench.batch(size).run("fmt::format_to of a unit value with a symbol",
+                          [&values, &out]()
+                          {
+                              out.clear();
+                              for (const auto& value : values) {
+                                  fmt::format_to(fmt::appender(out), "{}\n", value);
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(out);
+                          });
+}
+
+}  // namespace
+
+TEST_SUITE("fmt benchmarks")
+{
+    TEST_CASE("Custom Format Strings")
+    {
+        auto size = 1ULL << 16U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(10).relative(true);
+        benchmark_custom_format(bench, size);
+    }
+
+    TEST_CASE("Unit Symbols")
+    {
+        auto size = 1ULL << 16U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(10).relative(true);
+        benchmark_unit_symbol_format(bench, size);
+    }
+}
@@ -0,0 +1,129 @@
+#if !defined(__GNUC__) || defined(__clang__) || (__GNUC__ >= 13)
+
+#    include <algorithm>
+#    include <cstddef>
+#    include <string>
+#    include <vector>
+
+#    include <doctest/doctest.h>
+#    include <glaze/beve/read.hpp>
+#    include <glaze/beve/write.hpp>
+#    include <glaze/core/meta.hpp>
+#    include <glaze/json/read.hpp>
+#    include <glaze/json/write.hpp>
+#    include <nanobench.h>
+
+#    include "./benchmark_helpers.hpp"
+#    include "stronk/extensions/glaze.hpp"
+#    include "stronk/unit_vector.hpp"
+
+namespace
+{
+
+// Exposes its member through glz::meta like stronk types did before, so glaze handles the values one at a time
+struct element_wise_double
+{
+    double value;
+};
+
+using double_vector_t = twig::unit_vector<a_unit, double>;
+
+}  // namespace
+
+template<>
+struct glz::meta<element_wise_double>
+{
+    constexpr static auto value = &element_wise_double::value;
+};
+
+namespace
+{
+
+void benchmark_beve(ankerl::nanobench::Bench& bench, size_t size)
+{
+    auto values = std::vector<stronk_double_t>(size);
+    std::ranges::generate(values, []() { return generate_randomish<stronk_double_t> {}(); });
+    auto element_wise_values = std::vector<element_wise_double>(size);
+    std::ranges::transform(values,
+                           element_wise_values.begin(),
+                           [](stronk_double_t value)
+                           { return element_wise_double {value.unwrap<stronk_double_t>()}; });
+
+    auto buffer = std::string {};
+    bench.batch(size).run("glz::write_beve of values one at a time",
+                          [&element_wise_values, &buffer]()
+                          {
+                              buffer.clear();
+                              (void)glz::write_beve(element_wise_values, buffer);
+                              ankerl::nanobench::doNotOptimizeAway(buffer);
+                          });
+    bench.batch(size).run("glz::write_beve of stronk values as a typed array",
+                          [&values, &buffer]()
+                          {
+                              buffer.clear();
+                              (void)glz::write_beve(values, buffer);
+                              ankerl::nanobench::doNotOptimizeAway(buffer);
+                          });
+
+    const auto element_wise_beve = glz::write_beve(element_wise_values).value();
+    const auto typed_array_beve = glz::write_beve(values).value();
+    bench.batch(size).run("glz::read_beve of values one at a time",
+                          [&element_wise_beve, &element_wise_values]()
+                          {
+                              (void)glz::read_beve(element_wise_values, element_wise_beve);
+                              ankerl::nanobench::doNotOptimizeAway(element_wise_values);
+                          });
+    bench.batch(size).run("glz::read_beve of stronk values as a typed array",
+                          [&typed_array_beve, &values]()
+                          {
+                              (void)glz::read_beve(values, typed_array_beve);
+                              ankerl::nanobench::doNotOptimizeAway(values);
+                          });
+}
+
+void benchmark_json_to_unit_vector(ankerl::nanobench::Bench& bench, size_t size)
+{
+    auto values = std::vector<double>(size);
+    std::ranges::generate(values, []() { return generate_randomish<double> {}(); });
+    const auto json = glz::write_json(values).value();
+
+    bench.batch(size).run("glz::read_json into std::vector<double> and copy to a unit_vector",
+                          [&json]()
+                          {
+                              auto raw = std::vector<double> {};
+                              (void)glz::read_json(raw, json);
+                              auto result = double_vector_t(raw.size());
+                              std::ranges::copy(raw, result.unwrap<double_vector_t>().begin());
+                              ankerl::nanobench::doNotOptimizeAway(result);
+                          });
+    bench.batch(size).run("glz::read_json directly into a unit_vector",
+                          [&json]()
+                          {
+                              auto result = double_vector_t {};
+                              (void)glz::read_json(result, json);
+                              ankerl::nanobench::doNotOptimizeAway(result);
+                          });
+}
+
+}  // namespace
+
+TEST_SUITE("glaze benchmarks")
+{
+    TEST_CASE("BEVE Arrays")
+    {
+        auto size = 1ULL << 20U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(3).relative(true);
+        benchmark_beve(bench, size);
+    }
+
+    TEST_CASE("JSON Into unit_vector")
+    {
+        auto size = 1ULL << 18U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(3).relative(true);
+        benchmark_json_to_unit_vector(bench, size);
+    }
+}
+
+#endif
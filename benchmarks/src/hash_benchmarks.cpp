@@ -0,0 +1,330 @@
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string_view>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <absl/container/flat_hash_map.h>
+#include <doctest/doctest.h>
+#include <nanobench.h>
+
+#include "./benchmark_helpers.hpp"
+#include "stronk/extensions/absl.hpp"
+#include "stronk/prefabs/stronk_fixed_string.hpp"
+#include "stronk/prefabs/stronk_interned_string.hpp"
+#include "stronk/prefabs/stronk_string.hpp"
+#include "stronk/skills/can_hash.hpp"
+#include "stronk/stronk.hpp"
+
+namespace
+{
+
+template<typename HashPolicyT>
+struct an_id : twig::stronk<an_id<HashPolicyT>,
+                            int64_t,
+                            twig::can_equate,
+                            twig::can_absl_hash,
+                            twig::can_hash_with<HashPolicyT>::template skill>
+{
+    using twig::stronk<an_id<HashPolicyT>,
+                       int64_t,
+                       twig::can_equate,
+                       twig::can_absl_hash,
+                       twig::can_hash_with<HashPolicyT>::template skill>::stronk;
+};
+
+// Ids which are sequential in their high bits, like a row number combined with a small type tag in the low bits
+template<typename IdT>
+auto make_sequential_ids(std::size_t size) -> std::vector<IdT>
+{
+    auto ids = std::vector<IdT> {};
+    ids.reserve(size);
+    for (auto i = std::size_t {0}; i < size; i++) {
+        ids.emplace_back(static_cast<int64_t>(i) * 64);
+    }
+    return ids;
+}
+
+template<typename MapT>
+void benchmark_map(ankerl::nanobench::Bench& bench, const char* name, std::size_t size)
+{
+    using id_t = typename MapT::key_type;
+    const auto ids = make_sequential_ids<id_t>(size);
+    bench.batch(size).run(name,
+                          [&ids]()
+                          {
+                              auto map = MapT {};
+                              map.reserve(ids.size());
+                              for (const auto& id : ids) {
+                                  map[id] = 1;
+                              }
+                              auto found = 0;
+                              for (const auto& id : ids) {
+                                  found += map.find(id)->second;
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(found);
+                          });
+}
+
+template<typename HashPolicyT>
+using std_map_t = std::unordered_map<an_id<HashPolicyT>, int>;
+
+template<typename HashPolicyT>
+using absl_map_t = absl::flat_hash_map<an_id<HashPolicyT>, int, std::hash<an_id<HashPolicyT>>>;
+
+struct an_area_id : twig::stronk<an_area_id, int32_t, twig::can_equate>
+{
+    using stronk::stronk;
+};
+
+struct an_hour_id : twig::stronk<an_hour_id, int64_t, twig::can_equate>
+{
+    using stronk::stronk;
+};
+
+struct a_composite_key
+{
+    an_area_id area;
+    an_hour_id hour;
+
+    auto operator==(const a_composite_key& other) const -> bool = default;
+};
+
+// The common `hash(a) ^ hash(b)`, which collides for every pair of equal identity hashes
+struct xor_composite_hash
+{
+    auto operator()(const a_composite_key& key) const noexcept -> std::size_t
+    {
+        return std::hash<an_area_id> {}(key.area) ^ std::hash<an_hour_id> {}(key.hour);
+    }
+};
+
+template<typename HashPolicyT>
+struct combined_composite_hash
+{
+    auto operator()(const a_composite_key& key) const noexcept -> std::size_t
+    {
+        return twig::combined_hash<HashPolicyT>(key.area, key.hour);
+    }
+};
+
+template<typename HashT>
+void benchmark_composite_keys(ankerl::nanobench::Bench& bench, const char* name, std::size_t size)
+{
+    auto keys = std::vector<a_composite_key> {};
+    for (auto i = std::size_t {0}; i < size; i++) {
+        keys.push_back(a_composite_key {
+            an_area_id {static_cast<int32_t>(i % 64)},
+            an_hour_id {static_cast<int64_t>(i / 64)},
+        });
+    }
+    bench.batch(size).run(name,
+                          [&keys]()
+                          {
+                              auto map = std::unordered_map<a_composite_key, int, HashT> {};
+                              map.reserve(keys.size());
+                              for (const auto& key : keys) {
+                                  map[key] = 1;
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(map);
+                          });
+}
+
+template<typename HashPolicyT>
+void benchmark_hash_span(ankerl::nanobench::Bench& bench, const char* name, std::size_t size)
+{
+    using id_t = an_id<HashPolicyT>;
+    const auto ids = make_sequential_ids<id_t>(size);
+    auto hashes = std::vector<std::size_t>(size);
+    bench.batch(size).run(std::string {name} + " one at a time",
+                          [&ids, &hashes]()
+                          {
+                              for (auto i = std::size_t {0}; i < ids.size(); i++) {
+                                  hashes[i] = std::hash<id_t> {}(ids[i]);
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(hashes);
+                          });
+    bench.batch(size).run(std::string {name} + " with twig::hash_span",
+                          [&ids, &hashes]()
+                          {
+                              twig::hash_span<HashPolicyT>(std::span<const id_t> {ids},
+                                                           std::span<std::size_t> {hashes});
+                              ankerl::nanobench::doNotOptimizeAway(hashes);
+                          });
+}
+
+// Hashed by combining its member, like stronk types before they were marked as uniquely represented for absl
+struct an_element_wise_hashed_id
+{
+    int64_t value;
+
+    template<typename H>
+    friend auto AbslHashValue(H h, const an_element_wise_hashed_id& id) -> H
+    {
+        return H::combine(std::move(h), id.value);
+    }
+};
+
+template<typename IdT>
+void benchmark_absl_hash_of_vector(ankerl::nanobench::Bench& bench, const char* name, std::size_t size)
+{
+    auto ids = std::vector<IdT> {};
+    for (auto i = std::size_t {0}; i < size; i++) {
+        ids.push_back(IdT {static_cast<int64_t>(i)});
+    }
+    bench.batch(size).run(name,
+                          [&ids]()
+                          {
+                              auto hash = absl::HashOf(ids);
+                              ankerl::nanobench::doNotOptimizeAway(hash);
+                          });
+}
+
+struct an_instrument_name : twig::stronk_string<an_instrument_name>
+{
+    using stronk::stronk;
+};
+
+struct a_fixed_instrument_name : twig::stronk_fixed_string<a_fixed_instrument_name, 32>
+{
+    using stronk::stronk;
+};
+
+struct an_interned_instrument_name : twig::stronk_interned_string<an_interned_instrument_name>
+{
+    using stronk::stronk;
+};
+
+// Looks up a stream of instrument names from a small vocabulary, like the names of incoming trades
+template<typename NameT>
+void benchmark_name_lookups(ankerl::nanobench::Bench& bench, const char* name, std::size_t size)
+{
+    auto positions = std::unordered_map<NameT, double> {};
+    auto names = std::vector<NameT> {};
+    for (auto i = std::size_t {0}; i < size; i++) {
+        names.emplace_back("NP Power Nordic Hour Futures " + std::to_string(i % 256));
+        positions[names.back()] = 1.0;
+    }
+    bench.batch(size).run(name,
+                          [&names, &positions]()
+                          {
+                              auto total = 0.0;
+                              for (const auto& instrument : names) {
+                                  total += positions.find(instrument)->second;
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(total);
+                          });
+}
+
+// Looks up views into parsed messages, either constructing a key for each lookup or looking up by the view directly
+template<typename MapT, bool ByViewV>
+void benchmark_lookups_by_view(ankerl::nanobench::Bench& bench, const char* name, std::size_t size)
+{
+    using name_t = typename MapT::key_type;
+    auto positions = MapT {};
+    auto messages = std::vector<std::string> {};
+    for (auto i = std::size_t {0}; i < size; i++) {
+        messages.push_back("instrument=NP Power Nordic Hour Futures " + std::to_string(i % 256) + ";volume=1.0");
+        positions[name_t {messages.back().substr(11, messages.back().find(';') - 11)}] = 1.0;
+    }
+    bench.batch(size).run(name,
+                          [&messages, &positions]()
+                          {
+                              auto total = 0.0;
+                              for (const auto& message : messages) {
+                                  const auto view = std::string_view {message}.substr(11, message.find(';') - 11);
+                                  if constexpr (ByViewV) {
+                                      total += positions.find(view)->second;
+                                  } else {
+                                      total += positions.find(name_t {std::string {view}})->second;
+                                  }
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(total);
+                          });
+}
+
+}  // namespace
+
+TEST_SUITE("hash benchmarks")
+{
+    TEST_CASE("std::unordered_map Of Sequential Ids")
+    {
+        auto size = 1ULL << 18U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(3).relative(true);
+        benchmark_map<std_map_t<twig::identity_hash_policy>>(bench, "identity_hash_policy", size);
+        benchmark_map<std_map_t<twig::mix_hash_policy>>(bench, "mix_hash_policy", size);
+        benchmark_map<std_map_t<twig::crc32c_hash_policy>>(bench, "crc32c_hash_policy", size);
+    }
+
+    TEST_CASE("absl::flat_hash_map Of Sequential Ids")
+    {
+        auto size = 1ULL << 18U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(3).relative(true);
+        benchmark_map<absl::flat_hash_map<an_id<twig::identity_hash_policy>, int>>(bench, "absl::Hash", size);
+        benchmark_map<absl_map_t<twig::identity_hash_policy>>(bench, "identity_hash_policy", size);
+        benchmark_map<absl_map_t<twig::mix_hash_policy>>(bench, "mix_hash_policy", size);
+        benchmark_map<absl_map_t<twig::crc32c_hash_policy>>(bench, "crc32c_hash_policy", size);
+    }
+
+    TEST_CASE("absl::HashOf Id Vectors")
+    {
+        auto size = 1ULL << 16U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(10).relative(true);
+        benchmark_absl_hash_of_vector<an_element_wise_hashed_id>(bench, "element wise", size);
+        benchmark_absl_hash_of_vector<an_id<twig::identity_hash_policy>>(bench, "uniquely represented stronk", size);
+        benchmark_absl_hash_of_vector<int64_t>(bench, "int64_t", size);
+    }
+
+    TEST_CASE("Composite Keys")
+    {
+        auto size = 1ULL << 18U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(3).relative(true);
+        benchmark_composite_keys<xor_composite_hash>(bench, "xor of std::hash", size);
+        benchmark_composite_keys<combined_composite_hash<twig::mix_hash_policy>>(bench, "combined_hash mix", size);
+        benchmark_composite_keys<combined_composite_hash<twig::crc32c_hash_policy>>(
+            bench, "combined_hash crc32c", size);
+    }
+
+    TEST_CASE("String Keys")
+    {
+        auto size = 1ULL << 16U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(10).relative(true);
+        benchmark_name_lookups<an_instrument_name>(bench, "stronk_string", size);
+        benchmark_name_lookups<a_fixed_instrument_name>(bench, "stronk_fixed_string", size);
+        benchmark_name_lookups<an_interned_instrument_name>(bench, "stronk_interned_string", size);
+    }
+
+    TEST_CASE("String Key Lookups By View")
+    {
+        using std_map_t = std::unordered_map<an_instrument_name, double>;
+        using absl_map_t = absl::flat_hash_map<an_instrument_name,
+                                               double,
+                                               std::hash<an_instrument_name>,
+                                               std::equal_to<an_instrument_name>>;
+        auto size = 1ULL << 16U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(10).relative(true);
+        benchmark_lookups_by_view<std_map_t, false>(bench, "std::unordered_map constructing keys", size);
+        benchmark_lookups_by_view<std_map_t, true>(bench, "std::unordered_map by view", size);
+        benchmark_lookups_by_view<absl_map_t, false>(bench, "absl::flat_hash_map constructing keys", size);
+        benchmark_lookups_by_view<absl_map_t, true>(bench, "absl::flat_hash_map by view", size);
+    }
+
+    TEST_CASE("Batched Hashing")
+    {
+        auto size = 1ULL << 16U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(10).relative(true);
+        benchmark_hash_span<twig::mix_hash_policy>(bench, "mix_hash_policy", size);
+        benchmark_hash_span<twig::crc32c_hash_policy>(bench, "crc32c_hash_policy", size);
+    }
+}
@@ -0,0 +1,86 @@
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <nanobench.h>
+
+#include "./benchmark_helpers.hpp"
+#include "stronk/prefabs/stronk_index_vector.hpp"
+#include "stronk/skills/can_hash.hpp"
+
+namespace
+{
+
+struct a_node_id : twig::stronk<a_node_id, int32_t, twig::can_equate>
+{
+    using stronk::stronk;
+};
+
+// Ids to look up in a pseudo random order, so the lookups are not just a scan of the values
+auto make_lookup_ids(std::size_t size) -> std::vector<a_node_id>
+{
+    auto ids = std::vector<a_node_id> {};
+    ids.reserve(size);
+    for (auto i = std::size_t {0}; i < size; i++) {
+        ids.emplace_back(static_cast<int32_t>((i * 7919U) % size));
+    }
+    return ids;
+}
+
+void benchmark_unordered_map_lookups(ankerl::nanobench::Bench& bench, std::size_t size)
+{
+    auto weights = std::unordered_map<a_node_id, double> {};
+    for (auto i = std::size_t {0}; i < size; i++) {
+        weights[a_node_id {static_cast<int32_t>(i)}] = generate_randomish<double> {}();
+    }
+    const auto ids = make_lookup_ids(size);
+    auto out = std::vector<double>(size);
+    bench.batch(size).run("std::unordered_map",
+                          [&]()
+                          {
+                              for (auto i = std::size_t {0}; i < ids.size(); i++) {
+                                  out[i] = weights.find(ids[i])->second;
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(out);
+                          });
+}
+
+void benchmark_index_vector_lookups(ankerl::nanobench::Bench& bench, std::size_t size)
+{
+    auto weights = twig::stronk_index_vector<a_node_id, double>(size);
+    for (auto& weight : weights.values()) {
+        weight = generate_randomish<double> {}();
+    }
+    const auto ids = make_lookup_ids(size);
+    auto out = std::vector<double>(size);
+    bench.batch(size).run("stronk_index_vector operator[]",
+                          [&]()
+                          {
+                              for (auto i = std::size_t {0}; i < ids.size(); i++) {
+                                  out[i] = weights[ids[i]];
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(out);
+                          });
+    bench.batch(size).run("stronk_index_vector gather",
+                          [&]()
+                          {
+                              weights.gather(ids, out);
+                              ankerl::nanobench::doNotOptimizeAway(out);
+                          });
+}
+
+}  // namespace
+
+TEST_SUITE("stronk_index_vector benchmarks")
+{
+    TEST_CASE("Lookups By Id")
+    {
+        auto size = 1ULL << 18U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(10).relative(true);
+        benchmark_unordered_map_lookups(bench, size);
+        benchmark_index_vector_lookups(bench, size);
+    }
+}
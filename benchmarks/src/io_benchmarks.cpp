@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <fmt/format.h>
+#include <nanobench.h>
+
+#include "./benchmark_helpers.hpp"
+#include "stronk/io/binary.hpp"
+#include "stronk/io/csv.hpp"
+#include "stronk/io/mapped_series.hpp"
+#include "stronk/utilities/crc32c.hpp"
+
+namespace
+{
+
+template<typename T>
+auto to_binary(const std::vector<T>& values, twig::binary_checksum checksum) -> std::vector<std::byte>
+{
+    auto stream = std::ostringstream {};
+    twig::write_binary(stream, std::span<const T> {values}, checksum);
+    const auto str = stream.str();
+    auto bytes = std::vector<std::byte>(str.size());
+    std::memcpy(bytes.data(), str.data(), str.size());
+    return bytes;
+}
+
+template<typename T>
+void benchmark_binary_view(ankerl::nanobench::Bench& bench, size_t size)
+{
+    auto values = std::vector<T>(size);
+    std::ranges::generate(values, []() { return generate_randomish<T> {}(); });
+
+    const auto bytes = to_binary(values, twig::binary_checksum::none);
+    bench.batch(size).run(fmt::format("memcpy of {} values", get_name<T>()),
+                          [&bytes, &values]()
+                          {
+                              auto destination = std::as_writable_bytes(std::span {values});
+                              std::memcpy(destination.data(), bytes.data() + twig::binary_header::size,
+                                          destination.size());
+                              ankerl::nanobench::doNotOptimizeAway(values);
+                          });
+    bench.batch(size).run(fmt::format("twig::view_binary<{}>", get_name<T>()),
+                          [&bytes]()
+                          {
+                              auto view = twig::view_binary<T>(std::span<const std::byte> {bytes});
+                              ankerl::nanobench::doNotOptimizeAway(view);
+                          });
+
+    const auto checksummed = to_binary(values, twig::binary_checksum::crc32c);
+    bench.batch(size).run(fmt::format("twig::view_binary<{}> (crc32c)", get_name<T>()),
+                          [&checksummed]()
+                          {
+                              auto view = twig::view_binary<T>(std::span<const std::byte> {checksummed});
+                              ankerl::nanobench::doNotOptimizeAway(view);
+                          });
+}
+
+template<typename T>
+void benchmark_byteswap(ankerl::nanobench::Bench& bench, size_t size)
+{
+    auto values = std::vector<T>(size);
+    std::ranges::generate(values, []() { return generate_randomish<T> {}(); });
+    auto bytes = std::as_writable_bytes(std::span {values});
+
+    bench.batch(size).run(fmt::format("std::reverse the bytes of each {}", get_name<T>()),
+                          [&bytes]()
+                          {
+                              for (auto it = bytes.begin(); it != bytes.end(); it += sizeof(T)) {
+                                  std::reverse(it, it + sizeof(T));
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(bytes);
+                          });
+    bench.batch(size).run(fmt::format("byteswap_elements<sizeof({})>", get_name<T>()),
+                          [&bytes]()
+                          {
+                              twig::stronk_details::byteswap_elements<sizeof(T)>(bytes);
+                              ankerl::nanobench::doNotOptimizeAway(bytes);
+                          });
+}
+
+template<typename T>
+void benchmark_series_startup(ankerl::nanobench::Bench& bench, size_t size)
+{
+    auto values = std::vector<T>(size);
+    std::ranges::generate(values, []() { return generate_randomish<T> {}(); });
+    const auto path = std::filesystem::temp_directory_path() / "stronk_series_benchmark";
+    {
+        auto out = std::ofstream {path, std::ios::binary};
+        twig::write_mapped_series(out, std::span<const T> {values}, std::span<const T> {values});
+    }
+
+    bench.batch(size).run(fmt::format("twig::read_binary<{}> of the values", get_name<T>()),
+                          [&path]()
+                          {
+                              auto in = std::ifstream {path, std::ios::binary};
+                              // the times, the size is a multiple of the header size so no padding follows
+                              (void)twig::read_binary<T>(in);
+                              auto series_values = twig::read_binary<T>(in);
+                              ankerl::nanobench::doNotOptimizeAway(series_values);
+                          });
+    bench.batch(size).run(fmt::format("twig::mapped_series of {}", get_name<T>()),
+                          [&path]()
+                          {
+                              using unit_t = typename T::unit_t;
+                              auto series = twig::mapped_series<unit_t, unit_t, typename T::underlying_type> {path};
+                              ankerl::nanobench::doNotOptimizeAway(series.values());
+                          });
+    std::filesystem::remove(path);
+}
+
+template<typename T>
+void benchmark_csv_parsing(ankerl::nanobench::Bench& bench, size_t size)
+{
+    auto text = std::string {};
+    for (auto i = size_t {0}; i < size; i++) {
+        text += fmt::format("{},{}\n", i, generate_randomish<T> {}().template unwrap<T>());
+    }
+
+    bench.batch(size).run(fmt::format("std::istream extraction of {}", get_name<T>()),
+                          [&text, size]()
+                          {
+                              auto in = std::istringstream {text};
+                              auto values = std::vector<T> {};
+                              values.reserve(size);
+                              auto index = typename T::underlying_type {};
+                              auto value = typename T::underlying_type {};
+                              auto delimiter = char {};
+                              while (in >> index >> delimiter >> value) {
+                                  values.emplace_back(value);
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(values);
+                          });
+    bench.batch(size).run(fmt::format("twig::parse_csv<{}> on 1 thread", get_name<T>()),
+                          [&text]()
+                          {
+                              const auto options = twig::csv_options {.has_header = false, .threads = 1};
+                              auto soa = twig::parse_csv<T>(text, {1}, options);
+                              ankerl::nanobench::doNotOptimizeAway(soa);
+                          });
+    bench.batch(size).run(fmt::format("twig::parse_csv<{}>", get_name<T>()),
+                          [&text]()
+                          {
+                              auto soa = twig::parse_csv<T>(text, {1}, twig::csv_options {.has_header = false});
+                              ankerl::nanobench::doNotOptimizeAway(soa);
+                          });
+}
+
+template<typename T>
+void benchmark_csv_writing(ankerl::nanobench::Bench& bench, size_t size)
+{
+    auto times = std::vector<stronk_int64_t>(size);
+    std::ranges::generate(times, []() { return generate_randomish<stronk_int64_t> {}(); });
+    auto values = std::vector<T>(size);
+    std::ranges::generate(values, []() { return generate_randomish<T> {}(); });
+
+    bench.batch(size).run(fmt::format("std::ostream insertion of {}", get_name<T>()),
+                          [&times, &values]()
+                          {
+                              auto out = std::ostringstream {};
+                              out.precision(17);
+                              for (auto i = size_t {0}; i < values.size(); i++) {
+                                  out << times[i].unwrap<stronk_int64_t>() << ',' << values[i].template unwrap<T>()
+                                      << '\n';
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(out);
+                          });
+    bench.batch(size).run(fmt::format("twig::csv_writer of {}", get_name<T>()),
+                          [&times, &values]()
+                          {
+                              auto out = std::ostringstream {};
+                              {
+                                  auto writer = twig::csv_writer {out};
+                                  writer.write_rows(std::span<const stronk_int64_t> {times},
+                                                    std::span<const T> {values});
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(out);
+                          });
+}
+
+}  // namespace
+
+TEST_SUITE("IO Benchmarks")
+{
+    TEST_CASE("View Binary")
+    {
+        auto size = 1ULL << 20U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(10).relative(true);
+        benchmark_binary_view<stronk_double_t>(bench, size);
+    }
+
+    TEST_CASE("Series Startup")
+    {
+        auto size = 1ULL << 20U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(10).relative(true);
+        benchmark_series_startup<stronk_double_t>(bench, size);
+    }
+
+    TEST_CASE("CSV Parsing")
+    {
+        auto size = 1ULL << 20U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(3).relative(true);
+        benchmark_csv_parsing<stronk_double_t>(bench, size);
+    }
+
+    TEST_CASE("CSV Writing")
+    {
+        auto size = 1ULL << 20U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(3).relative(true);
+        benchmark_csv_writing<stronk_double_t>(bench, size);
+    }
+
+    TEST_CASE("Byteswap")
+    {
+        auto size = 1ULL << 20U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(10).relative(true);
+        benchmark_byteswap<stronk_double_t>(bench, size);
+
+        bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(10).relative(true);
+        benchmark_byteswap<stronk_int64_t>(bench, size);
+    }
+}
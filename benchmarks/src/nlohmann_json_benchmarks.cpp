@@ -0,0 +1,52 @@
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <nanobench.h>
+#include <nlohmann/json.hpp>
+
+#include "./benchmark_helpers.hpp"
+#include "stronk/extensions/nlohmann_json.hpp"
+
+namespace
+{
+
+void benchmark_json_array_reading(ankerl::nanobench::Bench& bench, size_t size)
+{
+    auto values = std::vector<double>(size);
+    std::ranges::generate(values, []() { return generate_randomish<double> {}(); });
+    const auto json = fmt::format(R"({{"area": "DK1", "prices": [{}]}})", fmt::join(values, ","));
+
+    // The DOM holds a json value of 16 bytes per number plus the vector it is converted to, while the SAX reader only
+    // holds the resulting vector. Reading 2^20 numbers from a file the peak RSS measured 53 MB against 12 MB.
+    bench.batch(size).run("nlohmann::json::parse and get",
+                          [&json]()
+                          {
+                              const auto dom = nlohmann::json::parse(json);
+                              auto result = dom.at("prices").get<std::vector<stronk_double_t>>();
+                              ankerl::nanobench::doNotOptimizeAway(result);
+                          });
+    bench.batch(size).run("twig::read_json_array",
+                          [&json]()
+                          {
+                              auto result = twig::read_json_array<std::vector<stronk_double_t>>(json, "prices");
+                              ankerl::nanobench::doNotOptimizeAway(result);
+                          });
+}
+
+}  // namespace
+
+TEST_SUITE("nlohmann json benchmarks")
+{
+    TEST_CASE("JSON Arrays")
+    {
+        auto size = 1ULL << 20U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(1).relative(true);
+        benchmark_json_array_reading(bench, size);
+    }
+}
@@ -0,0 +1,105 @@
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <nanobench.h>
+
+#include "./benchmark_helpers.hpp"
+#include "stronk/prefabs/stronk_slot_map.hpp"
+#include "stronk/skills/can_hash.hpp"
+
+namespace
+{
+
+struct an_order_id : twig::stronk<an_order_id, uint64_t, twig::can_equate>
+{
+    using stronk::stronk;
+};
+
+struct an_order_handle : twig::stronk<an_order_handle, uint64_t, twig::can_equate>
+{
+    using stronk::stronk;
+};
+
+struct an_order
+{
+    double price;
+    double volume;
+    int64_t delivery_start;
+};
+
+// Keeps `live` orders alive while replacing the oldest one every step, looking up a few of the live orders per step
+template<typename KeyT, typename InsertF, typename EraseF, typename LookupF>
+void run_order_churn(std::size_t live, std::size_t steps, InsertF insert, EraseF erase, LookupF lookup)
+{
+    auto keys = std::vector<KeyT> {};
+    keys.reserve(live);
+    for (auto i = std::size_t {0}; i < live; i++) {
+        keys.push_back(insert(an_order {1.0, 1.0, static_cast<int64_t>(i)}));
+    }
+    auto total = 0.0;
+    for (auto step = std::size_t {0}; step < steps; step++) {
+        auto& oldest = keys[step % live];
+        erase(oldest);
+        oldest = insert(an_order {2.0, 1.0, static_cast<int64_t>(step)});
+        for (auto i = std::size_t {1}; i <= 4; i++) {
+            total += lookup(keys[(step * 7919U + i) % live]).volume;
+        }
+    }
+    ankerl::nanobench::doNotOptimizeAway(total);
+}
+
+void benchmark_unordered_map_churn(ankerl::nanobench::Bench& bench, std::size_t live, std::size_t steps)
+{
+    bench.batch(steps).run("std::unordered_map",
+                           [&]()
+                           {
+                               auto orders = std::unordered_map<an_order_id, an_order> {};
+                               orders.reserve(live);
+                               auto next_id = uint64_t {0};
+                               run_order_churn<an_order_id>(
+                                   live,
+                                   steps,
+                                   [&](const an_order& order)
+                                   {
+                                       const auto id = an_order_id {next_id++};
+                                       orders.emplace(id, order);
+                                       return id;
+                                   },
+                                   [&](const an_order_id& id) { orders.erase(id); },
+                                   [&](const an_order_id& id) -> const an_order& { return orders.find(id)->second; });
+                           });
+}
+
+void benchmark_slot_map_churn(ankerl::nanobench::Bench& bench, std::size_t live, std::size_t steps)
+{
+    bench.batch(steps).run("stronk_slot_map",
+                           [&]()
+                           {
+                               auto orders = twig::stronk_slot_map<an_order_handle, an_order> {};
+                               orders.reserve(live);
+                               run_order_churn<an_order_handle>(
+                                   live,
+                                   steps,
+                                   [&](const an_order& order) { return orders.insert(order); },
+                                   [&](const an_order_handle& handle) { orders.erase(handle); },
+                                   [&](const an_order_handle& handle) -> const an_order& { return orders[handle]; });
+                           });
+}
+
+}  // namespace
+
+TEST_SUITE("stronk_slot_map benchmarks")
+{
+    TEST_CASE("Live Order Churn")
+    {
+        auto live = 1ULL << 16U;
+        auto steps = 1ULL << 18U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(3).relative(true);
+        benchmark_unordered_map_churn(bench, live, steps);
+        benchmark_slot_map_churn(bench, live, steps);
+    }
+}
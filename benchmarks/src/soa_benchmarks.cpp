@@ -0,0 +1,86 @@
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <doctest/doctest.h>
+#include <nanobench.h>
+
+#include "./benchmark_helpers.hpp"
+#include "stronk/prefabs/stronk_soa.hpp"
+
+namespace
+{
+
+struct area_id : twig::stronk<area_id, int16_t>
+{
+    using stronk::stronk;
+};
+
+struct delivery_start : twig::stronk<delivery_start, int64_t>
+{
+    using stronk::stronk;
+};
+
+struct price_t : twig::stronk<price_t, double>
+{
+    using stronk::stronk;
+};
+
+struct trade_record
+{
+    price_t price;
+    stronk_double_t volume;
+    delivery_start start;
+    area_id area;
+};
+
+void benchmark_array_of_structs_column_scan(ankerl::nanobench::Bench& bench, size_t size)
+{
+    auto trades = std::vector<trade_record>(size);
+    for (auto& trade : trades) {
+        trade.volume = generate_randomish<stronk_double_t> {}();
+    }
+
+    bench.batch(size).run("array of structs",
+                          [&trades]()
+                          {
+                              auto total = stronk_double_t {0.0};
+                              for (const auto& trade : trades) {
+                                  total += trade.volume;
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(total);
+                          });
+}
+
+void benchmark_stronk_soa_column_scan(ankerl::nanobench::Bench& bench, size_t size)
+{
+    auto trades = twig::stronk_soa<price_t, stronk_double_t, delivery_start, area_id> {};
+    trades.resize(size);
+    for (auto& volume : trades.column<stronk_double_t>()) {
+        volume = generate_randomish<stronk_double_t> {}();
+    }
+
+    bench.batch(size).run("stronk_soa",
+                          [&trades]()
+                          {
+                              auto total = stronk_double_t {0.0};
+                              for (const auto& volume : trades.column<stronk_double_t>()) {
+                                  total += volume;
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(total);
+                          });
+}
+
+}  // namespace
+
+TEST_SUITE("stronk_soa benchmarks")
+{
+    TEST_CASE("Single Column Scan")
+    {
+        auto size = 1ULL << 22U;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(10).relative(true);
+        benchmark_array_of_structs_column_scan(bench, size);
+        benchmark_stronk_soa_column_scan(bench, size);
+    }
+}
@@ -2,6 +2,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <numeric>
 #include <vector>
 
 #include <doctest/doctest.h>
@@ -9,6 +10,13 @@
 #include <nanobench.h>
 
 #include "./benchmark_helpers.hpp"
+#include "stronk/reductions.hpp"
+#include "stronk/unit_conversion.hpp"
+#include "stronk/unit_vector.hpp"
+
+#if __has_include(<experimental/simd>)
+#    include <experimental/simd>
+#endif
 
 namespace
 {
@@ -105,6 +113,41 @@ void benchmark_units_simd_operation(ankerl::nanobench::Bench& bench, size_t size
                           });
 }
 
+// Hand-written kernel over `T::value<native_simd>` (or plain `native_simd` for raw types), to compare the explicit
+// SIMD path against the auto-vectorized loops above. Does nothing where <experimental/simd> is not complete.
+template<typename T, typename Op>
+void benchmark_units_explicit_simd_operation([[maybe_unused]] ankerl::nanobench::Bench& bench,
+                                             [[maybe_unused]] size_t size,
+                                             [[maybe_unused]] const Op& op,
+                                             [[maybe_unused]] T o_min_val = T {})
+{
+#if defined(__cpp_lib_experimental_parallel_simd)
+    namespace stdx = std::experimental;
+    using scalar_t = twig::stronk_details::unit_value_underlying_t<T>;
+    using simd_t = stdx::native_simd<scalar_t>;
+    using value_t = twig::unit_value_t<typename twig::stronk_details::unit_value_underlying<T>::unit_t, simd_t>;
+
+    auto vec_a = std::vector<scalar_t>(size);
+    auto vec_b = std::vector<scalar_t>(size);
+    std::ranges::generate(vec_a, []() { return twig::stronk_details::unwrap_unit_value(generate_randomish<T> {}()); });
+    std::ranges::generate(vec_b,
+                          [&o_min_val]()
+                          { return twig::stronk_details::unwrap_unit_value(generate_randomish<T> {}() + o_min_val); });
+    size -= size % simd_t::size();
+
+    bench.batch(size).run(fmt::format("{} {} {} (native_simd)", get_name<T>(), Op::name, get_name<T>()),
+                          [&vec_a, &vec_b, &op, size]()
+                          {
+                              for (auto i = 0ULL; i < size; i += simd_t::size()) {
+                                  const auto a = value_t {simd_t(&vec_a[i], stdx::element_aligned)};
+                                  const auto b = value_t {simd_t(&vec_b[i], stdx::element_aligned)};
+                                  auto res = op(a, b);
+                                  ankerl::nanobench::doNotOptimizeAway(res);
+                              }
+                          });
+#endif
+}
+
 template<typename T>
 void benchmark_add_units(ankerl::nanobench::Bench& bench, size_t size)
 {
@@ -153,6 +196,134 @@ void benchmark_divide_units_simd(ankerl::nanobench::Bench& bench, size_t size)
     benchmark_units_simd_operation<T, O, WidthV>(bench, size, divide {}, O {1});  // NOLINT
 }
 
+template<typename T, typename O, typename Op>
+void benchmark_unit_vector_operation(ankerl::nanobench::Bench& bench, size_t size, const Op& op, O o_min_val = O {})
+{
+    auto vec_a = twig::basic_unit_vector<T>(size);
+    auto vec_b = twig::basic_unit_vector<O>(size);
+    for (auto i = 0ULL; i < size; i++) {
+        vec_a[i] = generate_randomish<T> {}();
+        vec_b[i] = generate_randomish<O> {}() + o_min_val;
+    }
+
+    auto res = twig::evaluate(op(vec_a, vec_b));
+    bench.batch(size).run(fmt::format("unit_vector<{}> {} unit_vector<{}>", get_name<T>(), Op::name, get_name<O>()),
+                          [&vec_a, &vec_b, &op, &res]()
+                          {
+                              res = op(vec_a, vec_b);
+                              ankerl::nanobench::doNotOptimizeAway(res);
+                          });
+}
+
+template<typename T>
+void benchmark_unit_vector_fused_expression(ankerl::nanobench::Bench& bench, size_t size)
+{
+    auto vec_a = twig::basic_unit_vector<T>(size);
+    auto vec_b = twig::basic_unit_vector<T>(size);
+    auto vec_c = twig::basic_unit_vector<T>(size);
+    for (auto i = 0ULL; i < size; i++) {
+        vec_a[i] = generate_randomish<T> {}();
+        vec_b[i] = generate_randomish<T> {}();
+        vec_c[i] = generate_randomish<T> {}();
+    }
+
+    auto res = twig::evaluate(vec_a * vec_b + vec_a * vec_c);
+    auto tmp_ab = twig::evaluate(vec_a * vec_b);
+    auto tmp_ac = twig::evaluate(vec_a * vec_c);
+    bench.batch(size).run(fmt::format("unit_vector<{}> a * b + a * c (one pass per operator)", get_name<T>()),
+                          [&vec_a, &vec_b, &vec_c, &tmp_ab, &tmp_ac, &res]()
+                          {
+                              tmp_ab = vec_a * vec_b;
+                              tmp_ac = vec_a * vec_c;
+                              res = tmp_ab + tmp_ac;
+                              ankerl::nanobench::doNotOptimizeAway(res);
+                          });
+    bench.batch(size).run(fmt::format("unit_vector<{}> a * b + a * c (fused)", get_name<T>()),
+                          [&vec_a, &vec_b, &vec_c, &res]()
+                          {
+                              res = vec_a * vec_b + vec_a * vec_c;
+                              ankerl::nanobench::doNotOptimizeAway(res);
+                          });
+}
+
+template<typename T>
+void benchmark_unit_reductions(ankerl::nanobench::Bench& bench, size_t size)
+{
+    auto vec_a = std::vector<T>(size);
+    auto vec_b = std::vector<T>(size);
+    std::ranges::generate(vec_a, []() { return generate_randomish<T> {}(); });
+    std::ranges::generate(vec_b, []() { return generate_randomish<T> {}(); });
+
+    bench.batch(size).run(fmt::format("std::accumulate<{}>", get_name<T>()),
+                          [&vec_a]()
+                          {
+                              auto res = std::accumulate(vec_a.begin(), vec_a.end(), T {});
+                              ankerl::nanobench::doNotOptimizeAway(res);
+                          });
+    bench.batch(size).run(fmt::format("twig::sum<{}>", get_name<T>()),
+                          [&vec_a]()
+                          {
+                              auto res = twig::sum(vec_a);
+                              ankerl::nanobench::doNotOptimizeAway(res);
+                          });
+    bench.batch(size).run(fmt::format("twig::sum<{}> (pairwise)", get_name<T>()),
+                          [&vec_a]()
+                          {
+                              auto res = twig::sum(vec_a, twig::pairwise_summation {});
+                              ankerl::nanobench::doNotOptimizeAway(res);
+                          });
+    bench.batch(size).run(fmt::format("twig::max<{}>", get_name<T>()),
+                          [&vec_a]()
+                          {
+                              auto res = twig::max(vec_a);
+                              ankerl::nanobench::doNotOptimizeAway(res);
+                          });
+    bench.batch(size).run(fmt::format("twig::dot<{}>", get_name<T>()),
+                          [&vec_a, &vec_b]()
+                          {
+                              auto res = twig::dot(vec_a, vec_b);
+                              ankerl::nanobench::doNotOptimizeAway(res);
+                          });
+}
+
+template<typename T>
+void benchmark_scale_conversion(ankerl::nanobench::Bench& bench, size_t size)
+{
+    using to_unit_t = typename T::unit_t::template scaled_t<twig::kilo>;
+    using result_t = twig::converted_value_t<to_unit_t, T>;
+
+    auto vec_a = std::vector<T>(size);
+    std::ranges::generate(vec_a, []() { return generate_randomish<T> {}(); });
+    auto res = std::vector<result_t>(size);
+
+    bench.batch(size).run(fmt::format("{} * num / den per element", get_name<T>()),
+                          [&vec_a, &res]()
+                          {
+                              using underlying_t = typename T::underlying_type;
+                              using ratio_t = twig::ratio_divide<typename T::unit_t::scale_t, twig::kilo>;
+                              for (auto i = 0ULL; i < vec_a.size(); i++) {
+                                  res[i] = result_t {vec_a[i].template unwrap<T>()  // NOLINT
+                                                     * static_cast<underlying_t>(ratio_t::num)
+                                                     / static_cast<underlying_t>(ratio_t::den)};
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(res);
+                          });
+    bench.batch(size).run(fmt::format("{}::to<kilo>() per element", get_name<T>()),
+                          [&vec_a, &res]()
+                          {
+                              for (auto i = 0ULL; i < vec_a.size(); i++) {
+                                  res[i] = vec_a[i].template to<to_unit_t>();  // NOLINT
+                              }
+                              ankerl::nanobench::doNotOptimizeAway(res);
+                          });
+    bench.batch(size).run(fmt::format("twig::convert<kilo>(span<{}>)", get_name<T>()),
+                          [&vec_a, &res]()
+                          {
+                              twig::convert<to_unit_t>(vec_a, res);
+                              ankerl::nanobench::doNotOptimizeAway(res);
+                          });
+}
+
 }  // namespace
 
 TEST_SUITE("Unit Operations Benchmarks")
@@ -190,6 +361,8 @@ TEST_SUITE("Unit Operations Benchmarks")
         bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(100).relative(true);
         benchmark_add_units_simd<double, width>(bench, size);
         benchmark_add_units_simd<stronk_double_t, width>(bench, size);
+        benchmark_units_explicit_simd_operation<double>(bench, size, add {});
+        benchmark_units_explicit_simd_operation<stronk_double_t>(bench, size, add {});
     }
 
     TEST_CASE("Subtract Units")
@@ -225,6 +398,8 @@ TEST_SUITE("Unit Operations Benchmarks")
         bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(100).relative(true);
         benchmark_subtract_units_simd<double, width>(bench, size);
         benchmark_subtract_units_simd<stronk_double_t, width>(bench, size);
+        benchmark_units_explicit_simd_operation<double>(bench, size, subtract {});
+        benchmark_units_explicit_simd_operation<stronk_double_t>(bench, size, subtract {});
     }
 
     TEST_CASE("multiply_units_benchmarks")
@@ -268,6 +443,8 @@ TEST_SUITE("Unit Operations Benchmarks")
         bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(100).relative(true);
         benchmark_multiply_units_simd<double, double, width>(bench, size);
         benchmark_multiply_units_simd<stronk_double_t, stronk_double_t, width>(bench, size);
+        benchmark_units_explicit_simd_operation<double>(bench, size, multiply {});
+        benchmark_units_explicit_simd_operation<stronk_double_t>(bench, size, multiply {});
 
         bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(100).relative(true);
         benchmark_multiply_units_simd<int64_t, double, width>(bench, size);
@@ -319,6 +496,8 @@ TEST_SUITE("Unit Operations Benchmarks")
         bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(100).relative(true);
         benchmark_divide_units_simd<double, double, width>(bench, size);
         benchmark_divide_units_simd<stronk_double_t, stronk_double_t, width>(bench, size);
+        benchmark_units_explicit_simd_operation<double>(bench, size, divide {}, 1.0);
+        benchmark_units_explicit_simd_operation<stronk_double_t>(bench, size, divide {}, stronk_double_t {1.0});
 
         bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(100).relative(true);
         benchmark_divide_units_simd<int64_t, double, width>(bench, size);
@@ -328,4 +507,52 @@ TEST_SUITE("Unit Operations Benchmarks")
         benchmark_divide_units_simd<double, int64_t, width>(bench, size);
         benchmark_divide_units_simd<stronk_double_t, stronk_int64_t, width>(bench, size);
     }
+
+    TEST_CASE("Unit Vector Bulk Operations")
+    {
+        auto size = 8192ULL;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(100).relative(true);
+        benchmark_units_operation<stronk_double_t, stronk_double_t>(bench, size, add {});
+        benchmark_unit_vector_operation<stronk_double_t, stronk_double_t>(bench, size, add {});
+
+        bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(100).relative(true);
+        benchmark_units_operation<stronk_double_t, stronk_double_t>(bench, size, multiply {});
+        benchmark_unit_vector_operation<stronk_double_t, stronk_double_t>(bench, size, multiply {});
+
+        bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(100).relative(true);
+        benchmark_units_operation<stronk_double_t, stronk_double_t>(bench, size, divide {}, stronk_double_t {1.0});
+        benchmark_unit_vector_operation<stronk_double_t, stronk_double_t>(
+            bench, size, divide {}, stronk_double_t {1.0});
+    }
+
+    TEST_CASE("Unit Vector Fused Expressions")
+    {
+        auto size = 8192ULL;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(100).relative(true);
+        benchmark_unit_vector_fused_expression<stronk_double_t>(bench, size);
+    }
+
+    TEST_CASE("Scale Conversion")
+    {
+        auto size = 8192ULL;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(100).relative(true);
+        benchmark_scale_conversion<stronk_double_t>(bench, size);
+
+        bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(100).relative(true);
+        benchmark_scale_conversion<stronk_int64_t>(bench, size);
+    }
+
+    TEST_CASE("Unit Reductions")
+    {
+        auto size = 8192ULL;
+
+        auto bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(100).relative(true);
+        benchmark_unit_reductions<double>(bench, size);
+
+        bench = ankerl::nanobench::Bench {}.title(current_test_name()).warmup(100).relative(true);
+        benchmark_unit_reductions<stronk_double_t>(bench, size);
+    }
 }
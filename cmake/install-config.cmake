@@ -1,5 +1,5 @@
 include(CMakeFindDependencyMacro)
 
-find_dependency(Boost COMPONENTS type_index)
+find_dependency(Threads)
 
 include("${CMAKE_CURRENT_LIST_DIR}/stronkTargets.cmake")
@@ -4,6 +4,7 @@
 
 #include "stronk/stronk.hpp"
 #include "stronk/unit.hpp"
+#include "stronk/utilities/simd.hpp"
 
 namespace twig
 {
@@ -76,7 +77,14 @@ constexpr auto pow(const UnitT& elem) -> auto
     using resulting_unit_t =
         twig::unit_lookup<typename UnitT::unit_t::dimensions_t::template power_t<PowerV>>::template unit_t<scale_t>;
     using std::pow;
-    return make<resulting_unit_t>(pow(elem.template unwrap<UnitT>(), static_cast<double>(PowerV)));
+    if constexpr (simd_like<typename UnitT::underlying_type>) {
+        // simd pow only takes simd exponents of the same type
+        using underlying_t = typename UnitT::underlying_type;
+        return make<resulting_unit_t>(
+            pow(elem.template unwrap<UnitT>(), underlying_t(static_cast<simd_scalar_t<underlying_t>>(PowerV))));
+    } else {
+        return make<resulting_unit_t>(pow(elem.template unwrap<UnitT>(), static_cast<double>(PowerV)));
+    }
 }
 
 }  // namespace twig
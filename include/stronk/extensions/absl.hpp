@@ -1,8 +1,11 @@
 #pragma once
+#include <type_traits>
 #include <utility>
 
 #include <absl/hash/hash.h>  // IWYU pragma: keep
 
+#include "stronk/stronk.hpp"
+
 namespace twig
 {
 template<class StronkT>
@@ -15,3 +18,15 @@ struct can_absl_hash
     }
 };
 }  // namespace twig
+
+// Stronk types hashed with can_absl_hash are uniquely represented when their underlying type is (i.e. integers but not
+// floating points) and they add no other bytes. absl then hashes contiguous ranges of them, e.g. a std::vector of ids,
+// as one range of bytes instead of element by element. Note the trait lives in absl's hash_internal namespace.
+template<twig::stronk_like StronkT>
+    requires(std::is_base_of_v<twig::can_absl_hash<StronkT>, StronkT>
+             && absl::hash_internal::is_uniquely_represented<typename StronkT::underlying_type>::value
+             && sizeof(StronkT) == sizeof(typename StronkT::underlying_type)
+             && std::is_standard_layout_v<StronkT>)
+struct absl::hash_internal::is_uniquely_represented<StronkT> : std::true_type
+{
+};
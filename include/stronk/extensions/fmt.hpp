@@ -11,6 +11,8 @@
 #include <fmt/format.h>
 
 #include "stronk/stronk.hpp"
+#include "stronk/unit.hpp"
+#include "stronk/unit_symbol.hpp"
 #include "stronk/utilities/strings.hpp"
 
 namespace twig
@@ -44,15 +46,54 @@ struct fmt::formatter<T>
 {
     constexpr static auto fmt_string = static_cast<std::string_view>(T::fmt_string);
 
+    template<typename ParseContext>
+    constexpr auto parse(ParseContext& ctx) -> decltype(ctx.begin())
+    {
+        this->_has_specs = ctx.begin() != ctx.end() && *ctx.begin() != '}';
+        return std::conditional_t<fmt_string == "{}",
+                                  formatter<typename T::underlying_type>,
+                                  formatter<fmt::string_view>>::parse(ctx);
+    }
+
     template<typename FormatContext>
     auto format(const T& val, FormatContext& ctx) const
     {
         if constexpr (fmt_string == "{}") {
             return formatter<typename T::underlying_type>::format(val.template unwrap<T>(), ctx);
         } else {
-            return formatter<fmt::string_view>::format(fmt::format(FMT_COMPILE(fmt_string), val.template unwrap<T>()),
-                                                       ctx);
+            if (!this->_has_specs) {
+                return fmt::format_to(ctx.out(), FMT_COMPILE(fmt_string), val.template unwrap<T>());
+            }
+            // the width of the padding depends on the formatted size, so format onto the stack first
+            auto buffer = fmt::memory_buffer {};
+            fmt::format_to(fmt::appender(buffer), FMT_COMPILE(fmt_string), val.template unwrap<T>());
+            return formatter<fmt::string_view>::format(fmt::string_view {buffer.data(), buffer.size()}, ctx);
+        }
+    }
+
+  private:
+    bool _has_specs = false;
+};
+
+/**
+ * @brief Formats unit values whose unit has a symbol (see stronk/unit_symbol.hpp) followed by the symbol, e.g.
+ * `12.5 MWh`. Format specifiers apply to the number.
+ */
+template<twig::unit_value_with_symbol_like T>
+    requires(!twig::can_special_fmt_format_like<T>)
+struct fmt::formatter<T> : formatter<typename T::underlying_type>
+{
+    constexpr static auto symbol = twig::unit_symbol_v<typename T::unit_t>;
+
+    template<typename FormatContext>
+    auto format(const T& val, FormatContext& ctx) const
+    {
+        auto out = formatter<typename T::underlying_type>::format(val.template unwrap<T>(), ctx);
+        *out++ = ' ';
+        for (auto c : symbol) {
+            *out++ = c;
         }
+        return out;
     }
 };
 
@@ -61,7 +102,7 @@ struct fmt::formatter<T>
  *   Use the can_fmt_format skill to specify the format string.
  */
 template<twig::stronk_like T>
-    requires(!twig::can_special_fmt_format_like<T>)
+    requires(!twig::can_special_fmt_format_like<T> && !twig::unit_value_with_symbol_like<T>)
 struct fmt::formatter<T> : formatter<typename T::underlying_type>
 {
     template<typename FormatContext>
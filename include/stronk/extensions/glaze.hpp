@@ -1,11 +1,22 @@
 #pragma once
 // IWYU pragma: always_keep
 
+#include <algorithm>
+#include <bit>
+#include <cstddef>
 #include <cstdint>  // IWYU pragma: keep // due to missing include in glaze core - check if needed in the future
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
 
+#include <glaze/core/common.hpp>
+#include <glaze/core/context.hpp>
 #include <glaze/core/meta.hpp>
+#include <glaze/core/opts.hpp>
 
 #include "stronk/stronk.hpp"
+#include "stronk/unit_vector.hpp"
 
 template<twig::stronk_like StronkT>
 struct glz::meta<StronkT>
@@ -13,3 +24,171 @@ struct glz::meta<StronkT>
     using T = StronkT;
     constexpr static auto value = &T::_you_should_not_be_using_this_but_rather_unwrap;
 };
+
+namespace twig::stronk_details
+{
+
+template<typename T>
+constexpr auto is_character_v = std::is_same_v<T, char> || std::is_same_v<T, wchar_t> || std::is_same_v<T, char8_t>
+    || std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>;
+
+// Stronk values with the layout of a number of up to 8 bytes, which BEVE stores as typed arrays
+template<typename T>
+concept beve_typed_array_element = stronk_like<T> && std::is_standard_layout_v<T>
+    && std::is_arithmetic_v<underlying_or_self_t<T>> && !std::is_same_v<underlying_or_self_t<T>, bool>
+    && !is_character_v<underlying_or_self_t<T>> && sizeof(underlying_or_self_t<T>) <= sizeof(std::uint64_t)
+    && sizeof(T) == sizeof(underlying_or_self_t<T>) && alignof(T) == alignof(underlying_or_self_t<T>);
+
+// The BEVE header of a typed array: the typed array tag, then the kind of number and the log2 of its byte count
+template<typename T>
+constexpr auto beve_typed_array_header() noexcept -> std::uint8_t
+{
+    constexpr auto typed_array_tag = 4U;
+    constexpr auto number_kind = std::is_floating_point_v<T> ? 0U : (std::is_signed_v<T> ? 1U : 2U);
+    constexpr auto byte_count_index = static_cast<unsigned>(std::bit_width(sizeof(T)) - 1);
+    return static_cast<std::uint8_t>(typed_array_tag | (number_kind << 3U) | (byte_count_index << 5U));
+}
+
+// Writes the values as a BEVE typed array: the header, the compressed element count and then all the values in a
+// single memcpy.
+template<beve_typed_array_element T>
+void write_beve_typed_array(std::span<const T> values, auto& buffer, std::size_t& index)
+{
+    static_assert(std::endian::native == std::endian::little, "BEVE typed arrays are little endian");
+
+    const auto count = static_cast<std::uint64_t>(values.size());
+    // the two lowest bits of a compressed integer give its size of 1, 2, 4 or 8 bytes
+    const auto count_size_index = count < (1ULL << 6U) ? 0U
+        : count < (1ULL << 14U)                         ? 1U
+        : count < (1ULL << 30U)                         ? 2U
+                                                        : 3U;
+    const auto count_size = std::size_t {1} << count_size_index;
+    const auto required = index + 1 + count_size + values.size_bytes();
+    if constexpr (requires { buffer.resize(required); }) {
+        if (required > buffer.size()) {
+            buffer.resize(std::max(required, 2 * buffer.size()));
+        }
+    }
+
+    buffer[index++] = static_cast<char>(beve_typed_array_header<underlying_or_self_t<T>>());
+    const auto compressed_count = (count << 2U) | count_size_index;
+    for (auto i = std::size_t {0}; i < count_size; i++) {
+        buffer[index++] = static_cast<char>((compressed_count >> (8U * i)) & 0xFFU);
+    }
+    if (!values.empty()) {
+        std::memcpy(&buffer[index], values.data(), values.size_bytes());
+        index += values.size_bytes();
+    }
+}
+
+// Reads a BEVE typed array of the underlying type of T, resizing the vector once and copying the values in a single
+// memcpy.
+template<beve_typed_array_element T, typename AllocatorT>
+void read_beve_typed_array(std::vector<T, AllocatorT>& values, auto& ctx, auto& it, const auto& end)
+{
+    static_assert(std::endian::native == std::endian::little, "BEVE typed arrays are little endian");
+
+    const auto remaining = [&it, &end]() { return static_cast<std::size_t>(end - it); };
+    if (remaining() < 2) {
+        ctx.error = glz::error_code::unexpected_end;
+        return;
+    }
+    if (static_cast<std::uint8_t>(*it) != beve_typed_array_header<underlying_or_self_t<T>>()) {
+        ctx.error = glz::error_code::syntax_error;
+        return;
+    }
+    ++it;
+
+    const auto count_size = std::size_t {1} << (static_cast<std::uint8_t>(*it) & 3U);
+    if (remaining() < count_size) {
+        ctx.error = glz::error_code::unexpected_end;
+        return;
+    }
+    auto compressed_count = std::uint64_t {0};
+    for (auto i = std::size_t {0}; i < count_size; i++) {
+        compressed_count |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(it[i])) << (8U * i);
+    }
+    it += count_size;
+
+    const auto count = compressed_count >> 2U;
+    if (count > remaining() / sizeof(T)) {
+        ctx.error = glz::error_code::unexpected_end;
+        return;
+    }
+    values.resize(static_cast<std::size_t>(count));
+    if (count != 0) {
+        std::memcpy(static_cast<void*>(values.data()), &*it, values.size() * sizeof(T));
+        it += values.size() * sizeof(T);
+    }
+}
+
+// unit_vectors are serialized as the vector of their raw values, so glaze reads and writes the numbers directly
+template<std::uint32_t FormatV, typename ValueT>
+struct glaze_unit_vector_to
+{
+    template<auto Opts>
+    static void op(const basic_unit_vector<ValueT>& value, auto&& ctx, auto&&... args)
+    {
+        const auto& storage = value.template unwrap_storage<basic_unit_vector<ValueT>>();
+        glz::to<FormatV, std::remove_cvref_t<decltype(storage)>>::template op<Opts>(storage, ctx, args...);
+    }
+};
+
+template<std::uint32_t FormatV, typename ValueT>
+struct glaze_unit_vector_from
+{
+    template<auto Opts>
+    static void op(basic_unit_vector<ValueT>& value, auto&& ctx, auto&&... args)
+    {
+        auto& storage = value.template unwrap_storage<basic_unit_vector<ValueT>>();
+        glz::from<FormatV, std::remove_cvref_t<decltype(storage)>>::template op<Opts>(storage, ctx, args...);
+    }
+};
+
+}  // namespace twig::stronk_details
+
+// Vectors of stronk numbers (also those wrapped by a stronk_vector) are BEVE typed arrays rather than arrays of
+// individually tagged values.
+template<twig::stronk_details::beve_typed_array_element T, typename AllocatorT>
+struct glz::to<glz::BEVE, std::vector<T, AllocatorT>>
+{
+    template<auto Opts>
+    static void op(const std::vector<T, AllocatorT>& value, auto&& /*ctx*/, auto&& buffer, auto&& index)
+    {
+        twig::stronk_details::write_beve_typed_array(std::span<const T> {value}, buffer, index);
+    }
+};
+
+template<twig::stronk_details::beve_typed_array_element T, typename AllocatorT>
+struct glz::from<glz::BEVE, std::vector<T, AllocatorT>>
+{
+    template<auto Opts>
+    static void op(std::vector<T, AllocatorT>& value, auto&& ctx, auto&& it, auto&& end)
+    {
+        twig::stronk_details::read_beve_typed_array(value, ctx, it, end);
+    }
+};
+
+template<typename ValueT>
+struct glz::to<glz::JSON, twig::basic_unit_vector<ValueT>>
+    : twig::stronk_details::glaze_unit_vector_to<glz::JSON, ValueT>
+{
+};
+
+template<typename ValueT>
+struct glz::from<glz::JSON, twig::basic_unit_vector<ValueT>>
+    : twig::stronk_details::glaze_unit_vector_from<glz::JSON, ValueT>
+{
+};
+
+template<typename ValueT>
+struct glz::to<glz::BEVE, twig::basic_unit_vector<ValueT>>
+    : twig::stronk_details::glaze_unit_vector_to<glz::BEVE, ValueT>
+{
+};
+
+template<typename ValueT>
+struct glz::from<glz::BEVE, twig::basic_unit_vector<ValueT>>
+    : twig::stronk_details::glaze_unit_vector_from<glz::BEVE, ValueT>
+{
+};
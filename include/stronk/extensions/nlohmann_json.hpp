@@ -1,10 +1,18 @@
 #pragma once
 // IWYU pragma: always_keep
 
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
 #include <nlohmann/adl_serializer.hpp>
 #include <nlohmann/json.hpp>
 #include <nlohmann/json_fwd.hpp>
 
+#include "stronk/skills/can_parse.hpp"
 #include "stronk/stronk.hpp"
 
 template<twig::stronk_like T>
@@ -20,3 +28,229 @@ struct nlohmann::adl_serializer<T>
         j.get_to(value.template unwrap<T>());
     }
 };
+
+namespace twig
+{
+
+namespace stronk_details
+{
+
+/**
+ * @brief A nlohmann SAX handler passing each number of one JSON array to a callback as a T, without building any json
+ * values. The array is either the whole document, or the value of a key of the top level object.
+ */
+template<parsable T, typename CallbackT>
+class json_number_array_sax
+{
+  public:
+    using json_t = nlohmann::json;
+
+    json_number_array_sax(CallbackT& callback, std::string_view key)
+        : _callback(&callback)
+        , _key(key)
+    {
+    }
+
+    auto null() -> bool
+    {
+        return this->non_number();
+    }
+
+    auto boolean(bool /*value*/) -> bool
+    {
+        return this->non_number();
+    }
+
+    auto number_integer(json_t::number_integer_t value) -> bool
+    {
+        return this->number(value);
+    }
+
+    auto number_unsigned(json_t::number_unsigned_t value) -> bool
+    {
+        return this->number(value);
+    }
+
+    auto number_float(json_t::number_float_t value, const json_t::string_t& /*text*/) -> bool
+    {
+        return this->number(value);
+    }
+
+    auto string(json_t::string_t& /*value*/) -> bool
+    {
+        return this->non_number();
+    }
+
+    auto binary(json_t::binary_t& /*value*/) -> bool
+    {
+        return this->non_number();
+    }
+
+    auto start_object(std::size_t /*size*/) -> bool
+    {
+        if (!this->value(false, true)) {
+            return false;
+        }
+        this->_depth++;
+        return true;
+    }
+
+    auto key(json_t::string_t& name) -> bool
+    {
+        this->_at_key = this->_depth == 1 && this->_array_depth == 0 && name == this->_key;
+        return true;
+    }
+
+    auto end_object() -> bool
+    {
+        this->_depth--;
+        return true;
+    }
+
+    auto start_array(std::size_t /*size*/) -> bool
+    {
+        const auto is_target = this->_array_depth == 0 && (this->_key.empty() ? this->_depth == 0 : this->_at_key);
+        if (!this->value(true, false)) {
+            return false;
+        }
+        this->_depth++;
+        if (is_target) {
+            this->_array_depth = this->_depth;
+        }
+        return true;
+    }
+
+    auto end_array() -> bool
+    {
+        if (this->in_array()) {
+            this->_done = true;
+        }
+        this->_depth--;
+        return true;
+    }
+
+    auto parse_error(std::size_t /*position*/, const std::string& /*last_token*/, const json_t::exception& error)
+        -> bool
+    {
+        this->_error = error.what();
+        return false;
+    }
+
+    // The reason parsing stopped, or that the document has no array to read
+    [[nodiscard]]
+    auto error() const -> std::string
+    {
+        if (!this->_error.empty()) {
+            return this->_error;
+        }
+        if (!this->_done) {
+            return this->_key.empty() ? "the JSON is not an array"
+                                      : "the JSON has no array at the key '" + std::string(this->_key) + "'";
+        }
+        return {};
+    }
+
+  private:
+    CallbackT* _callback;
+    std::string_view _key;
+    std::size_t _depth = 0;  // the number of arrays and objects the parser is inside
+    std::size_t _array_depth = 0;  // the depth inside the array being read, or 0 before it
+    std::size_t _count = 0;  // the number of elements read
+    bool _at_key = false;
+    bool _done = false;
+    std::string _error;
+
+    [[nodiscard]]
+    auto in_array() const noexcept -> bool
+    {
+        return this->_array_depth != 0 && !this->_done && this->_depth == this->_array_depth;
+    }
+
+    auto fail(const std::string& reason) -> bool
+    {
+        this->_error = reason;
+        return false;
+    }
+
+    // Checks a value which is not a number of the array, i.e. anything but the array and the object containing it
+    auto value(bool is_array, bool is_object) -> bool
+    {
+        if (this->in_array()) {
+            return this->fail("element " + std::to_string(this->_count) + " of the array is not a number");
+        }
+        if (this->_depth == 0 && this->_key.empty() && !is_array) {
+            return this->fail("the JSON is not an array");
+        }
+        if (this->_depth == 0 && !this->_key.empty() && !is_object) {
+            return this->fail("the JSON is not an object");
+        }
+        if (std::exchange(this->_at_key, false) && !is_array) {
+            return this->fail("the value of the key '" + std::string(this->_key) + "' is not an array");
+        }
+        return true;
+    }
+
+    auto non_number() -> bool
+    {
+        return this->value(false, false);
+    }
+
+    template<typename NumberT>
+    auto number(NumberT number) -> bool
+    {
+        if (!this->in_array()) {
+            return this->non_number();
+        }
+        using underlying_t = underlying_or_self_t<T>;
+        if constexpr (std::is_integral_v<underlying_t>) {
+            if constexpr (std::is_floating_point_v<NumberT>) {
+                return this->fail("element " + std::to_string(this->_count) + " of the array is not an integer");
+            } else if (!std::in_range<underlying_t>(number)) {
+                return this->fail("element " + std::to_string(this->_count) + " of the array is out of range");
+            }
+        }
+        (*this->_callback)(T {static_cast<underlying_t>(number)});
+        this->_count++;
+        return true;
+    }
+};
+
+}  // namespace stronk_details
+
+/**
+ * @brief Stream the numbers of a JSON array to the callback as T values, using the SAX interface of nlohmann so no json
+ * values are built and memory use does not grow with the size of the array.
+ *
+ * @param input anything nlohmann::json::sax_parse accepts, e.g. a std::istream, a string or a pair of iterators
+ * @param key if not empty, the array is the value of this key of the top level object, and the other values of the
+ * object are skipped. Otherwise the whole document must be the array.
+ * @throws std::invalid_argument if the JSON is invalid, has no such array, or an element is not a number fitting in T
+ */
+template<parsable T, typename InputT, typename CallbackT>
+void for_each_json_number(InputT&& input, CallbackT&& callback, std::string_view key = {})
+{
+    auto handler = stronk_details::json_number_array_sax<T, std::remove_reference_t<CallbackT>> {callback, key};
+    nlohmann::json::sax_parse(std::forward<InputT>(input), &handler);
+    if (auto error = handler.error(); !error.empty()) {
+        throw std::invalid_argument(error);
+    }
+}
+
+/**
+ * @brief Read the numbers of a JSON array into a container of stronk values, e.g. a std::vector or a unit_vector. See
+ * for_each_json_number.
+ */
+template<typename ContainerT, typename InputT>
+    requires(parsable<typename ContainerT::value_type>
+             && requires(ContainerT container, typename ContainerT::value_type value) { container.push_back(value); })
+[[nodiscard]]
+auto read_json_array(InputT&& input, std::string_view key = {}) -> ContainerT
+{
+    using value_t = typename ContainerT::value_type;
+    auto container = ContainerT {};
+    for_each_json_number<value_t>(
+        std::forward<InputT>(input), [&container](const value_t& value) { container.push_back(value); }, key);
+    return container;
+}
+
+}  // namespace twig
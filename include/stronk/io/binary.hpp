@@ -0,0 +1,418 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "stronk/stronk.hpp"
+#include "stronk/unit.hpp"
+#include "stronk/utilities/constexpr_helpers.hpp"
+#include "stronk/utilities/crc32c.hpp"
+#include "stronk/utilities/dimensions.hpp"
+#include "stronk/utilities/macros.hpp"
+#include "stronk/utilities/ratio.hpp"
+
+namespace twig
+{
+
+// Arithmetic values, and stronk values wrapping them with the same layout, which can be written and viewed as raw bytes
+template<typename T>
+concept binary_serializable = std::is_arithmetic_v<stronk_details::underlying_or_self_t<T>>
+    && !std::is_same_v<stronk_details::underlying_or_self_t<T>, bool> && std::is_standard_layout_v<T>
+    && sizeof(T) == sizeof(stronk_details::underlying_or_self_t<T>)
+    && alignof(T) == alignof(stronk_details::underlying_or_self_t<T>);
+
+enum class binary_checksum : std::uint8_t
+{
+    none,
+    crc32c,
+};
+
+/**
+ * @brief The header written in front of binary serialized values.
+ *
+ * The header itself is always stored little endian, while the values are stored in the byte order of the writer, as
+ * recorded in the flags, and are byte swapped by the reader when needed.
+ */
+struct binary_header
+{
+    constexpr static auto magic = std::array<char, 4> {'S', 'T', 'R', 'K'};
+    constexpr static auto current_version = std::uint16_t {1};
+    constexpr static auto size = std::size_t {32};  // keeps the values after it aligned to up to 32 bytes
+
+    constexpr static auto big_endian_flag = std::uint16_t {1U << 0U};
+    constexpr static auto checksum_flag = std::uint16_t {1U << 1U};
+
+    std::uint16_t version = current_version;
+    std::uint16_t flags = 0;
+    std::uint32_t element_size = 0;
+    std::uint32_t checksum = 0;  // crc32c of the values as stored, when the checksum flag is set
+    std::uint64_t fingerprint = 0;
+    std::uint64_t count = 0;
+
+    [[nodiscard]]
+    constexpr auto is_big_endian() const noexcept -> bool
+    {
+        return (this->flags & big_endian_flag) != 0;
+    }
+
+    [[nodiscard]]
+    constexpr auto has_checksum() const noexcept -> bool
+    {
+        return (this->flags & checksum_flag) != 0;
+    }
+
+    [[nodiscard]]
+    constexpr auto data_size() const noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(this->count) * this->element_size;
+    }
+
+    [[nodiscard]]
+    constexpr auto to_bytes() const noexcept -> std::array<std::byte, size>
+    {
+        auto bytes = std::array<std::byte, size> {};
+        auto offset = std::size_t {0};
+        auto put = [&bytes, &offset](std::uint64_t value, std::size_t value_size)
+        {
+            for (auto i = std::size_t {0}; i < value_size; i++, offset++) {
+                bytes[offset] = static_cast<std::byte>((value >> (8U * i)) & 0xFFU);
+            }
+        };
+        for (auto c : magic) {
+            put(static_cast<unsigned char>(c), 1);
+        }
+        put(this->version, sizeof(this->version));
+        put(this->flags, sizeof(this->flags));
+        put(this->element_size, sizeof(this->element_size));
+        put(this->checksum, sizeof(this->checksum));
+        put(this->fingerprint, sizeof(this->fingerprint));
+        put(this->count, sizeof(this->count));
+        return bytes;
+    }
+
+    // Parses the header at the start of the bytes
+    // @throws std::invalid_argument if the bytes do not start with a stronk binary header of a supported version
+    [[nodiscard]]
+    constexpr static auto from_bytes(std::span<const std::byte> bytes) -> binary_header
+    {
+        if (bytes.size() < size) {
+            throw std::invalid_argument("not enough bytes for a stronk binary header");
+        }
+        auto offset = std::size_t {0};
+        auto get = [&bytes, &offset](std::size_t value_size)
+        {
+            auto value = std::uint64_t {0};
+            for (auto i = std::size_t {0}; i < value_size; i++, offset++) {
+                value |= static_cast<std::uint64_t>(bytes[offset]) << (8U * i);
+            }
+            return value;
+        };
+        for (auto c : magic) {
+            if (get(1) != static_cast<unsigned char>(c)) {
+                throw std::invalid_argument("the bytes do not start with a stronk binary header");
+            }
+        }
+        auto header = binary_header {};
+        header.version = static_cast<std::uint16_t>(get(sizeof(header.version)));
+        header.flags = static_cast<std::uint16_t>(get(sizeof(header.flags)));
+        header.element_size = static_cast<std::uint32_t>(get(sizeof(header.element_size)));
+        header.checksum = static_cast<std::uint32_t>(get(sizeof(header.checksum)));
+        header.fingerprint = get(sizeof(header.fingerprint));
+        header.count = get(sizeof(header.count));
+        if (header.version != current_version) {
+            throw std::invalid_argument("unsupported stronk binary format version");
+        }
+        return header;
+    }
+};
+
+namespace stronk_details
+{
+
+constexpr auto fnv1a_offset_basis = std::uint64_t {14695981039346656037ULL};
+
+constexpr auto fnv1a(std::string_view text, std::uint64_t hash = fnv1a_offset_basis) noexcept -> std::uint64_t
+{
+    for (auto c : text) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * std::uint64_t {1099511628211ULL};
+    }
+    return hash;
+}
+
+constexpr auto fnv1a(u_biggest_int_t value, std::uint64_t hash = fnv1a_offset_basis) noexcept -> std::uint64_t
+{
+    for (auto i = std::size_t {0}; i < sizeof(value); i++, value >>= 8U) {
+        hash = (hash ^ static_cast<std::uint64_t>(value & 0xFFU)) * std::uint64_t {1099511628211ULL};
+    }
+    return hash;
+}
+
+// The ranks and names of the units of the dimensions. Combined by summing, so it does not depend on the compiler
+// specific order of the dimensions.
+template<typename DimensionsT>
+struct dimensions_fingerprint;
+
+template<typename... DimTs>
+struct dimensions_fingerprint<details::dimensions<DimTs...>>
+{
+    constexpr static auto value = (std::uint64_t {0} + ...
+                                   + fnv1a(static_cast<u_biggest_int_t>(static_cast<std::uint16_t>(DimTs::rank)),
+                                           fnv1a(type_name<typename DimTs::unit_t>())));
+};
+
+template<std::unsigned_integral T>
+constexpr auto byteswap(T value) noexcept -> T
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (sizeof(T) == 2) {
+        return __builtin_bswap16(value);
+    } else if constexpr (sizeof(T) == 4) {
+        return __builtin_bswap32(value);
+    } else if constexpr (sizeof(T) == 8) {
+        return __builtin_bswap64(value);
+    }
+#endif
+    auto res = T {0};
+    for (auto i = std::size_t {0}; i < sizeof(T); i++, value >>= 8U) {
+        res = static_cast<T>((res << 8U) | (value & 0xFFU));
+    }
+    return res;
+}
+
+template<std::size_t SizeV>
+struct unsigned_of_size;
+
+template<>
+struct unsigned_of_size<2>
+{
+    using type = std::uint16_t;
+};
+
+template<>
+struct unsigned_of_size<4>
+{
+    using type = std::uint32_t;
+};
+
+template<>
+struct unsigned_of_size<8>
+{
+    using type = std::uint64_t;
+};
+
+// Reverses the byte order of each SizeV sized element of the bytes, in place
+template<std::size_t SizeV>
+void byteswap_elements(std::span<std::byte> bytes) noexcept
+{
+    if constexpr (SizeV > 1) {
+        using uint_t = typename unsigned_of_size<SizeV>::type;
+        auto* data = bytes.data();
+        const auto count = bytes.size() / SizeV;
+        STRONK_VECTORIZE_LOOP
+        for (auto i = std::size_t {0}; i < count; i++) {
+            auto value = uint_t {0};
+            std::memcpy(&value, data + (i * SizeV), SizeV);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            value = byteswap(value);
+            std::memcpy(data + (i * SizeV), &value, SizeV);  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+    }
+}
+
+constexpr auto native_is_big_endian() noexcept -> bool
+{
+    static_assert(std::endian::native == std::endian::little || std::endian::native == std::endian::big,
+                  "mixed endian platforms are not supported");
+    return std::endian::native == std::endian::big;
+}
+
+// Validates the header and returns it together with the bytes of the values
+template<typename T>
+auto parse_binary(std::span<const std::byte> bytes, bool verify_checksum = true)
+    -> std::pair<binary_header, std::span<const std::byte>>;
+
+}  // namespace stronk_details
+
+/**
+ * @brief A fingerprint of the type of binary serialized values, written in the header and checked when reading.
+ *
+ * It covers the kind and size of the underlying type, and the dimensions and scale of unit values or the name of other
+ * stronk types. The names of the units are used, so renaming a unit changes the fingerprint.
+ */
+template<binary_serializable T>
+constexpr auto binary_fingerprint() noexcept -> std::uint64_t
+{
+    using underlying_t = stronk_details::underlying_or_self_t<T>;
+    constexpr auto kind = std::is_floating_point_v<underlying_t> ? 'f' : (std::is_signed_v<underlying_t> ? 'i' : 'u');
+    auto hash = stronk_details::fnv1a(std::string_view {&kind, 1});
+    hash = stronk_details::fnv1a(sizeof(underlying_t), hash);
+    if constexpr (unit_value_like<T>) {
+        using unit_t = typename T::unit_t;
+        using dimensions_fingerprint_t = stronk_details::dimensions_fingerprint<typename unit_t::dimensions_t>;
+        hash = stronk_details::fnv1a(dimensions_fingerprint_t::value, hash);
+        hash = stronk_details::fnv1a(unit_t::scale_t::num, hash);
+        hash = stronk_details::fnv1a(unit_t::scale_t::den, hash);
+    } else if constexpr (stronk_like<T>) {
+        hash = stronk_details::fnv1a(stronk_details::type_name<T>(), hash);
+    }
+    return hash;
+}
+
+template<binary_serializable T>
+[[nodiscard]]
+auto make_binary_header(std::span<const T> values, binary_checksum checksum = binary_checksum::none) -> binary_header
+{
+    auto header = binary_header {};
+    header.element_size = static_cast<std::uint32_t>(sizeof(T));
+    header.fingerprint = binary_fingerprint<T>();
+    header.count = static_cast<std::uint64_t>(values.size());
+    if constexpr (stronk_details::native_is_big_endian()) {
+        header.flags |= binary_header::big_endian_flag;
+    }
+    if (checksum == binary_checksum::crc32c) {
+        header.flags |= binary_header::checksum_flag;
+        header.checksum = stronk_details::crc32c(std::as_bytes(values));
+    }
+    return header;
+}
+
+/**
+ * @brief Write the values as raw bytes after a binary_header, with the values written in a single write call.
+ */
+template<binary_serializable T>
+void write_binary(std::ostream& out, std::span<const T> values, binary_checksum checksum = binary_checksum::none)
+{
+    const auto header = make_binary_header(values, checksum).to_bytes();
+    const auto bytes = std::as_bytes(values);
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    out.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+/**
+ * @brief View binary serialized values in place, without copying them.
+ *
+ * @param bytes a header followed by the values, where the values need to be aligned for T
+ * @throws std::invalid_argument if the header does not match T, the bytes are too short or misaligned, the checksum
+ * does not match, or the values were written with another byte order (use the overload taking mutable bytes to swap
+ * them)
+ */
+template<binary_serializable T>
+[[nodiscard]]
+auto view_binary(std::span<const std::byte> bytes) -> std::span<const T>
+{
+    auto [header, data] = stronk_details::parse_binary<T>(bytes);
+    if (header.is_big_endian() != stronk_details::native_is_big_endian()) {
+        throw std::invalid_argument("the values were written with another byte order, and need to be swapped");
+    }
+    // the values are implicitly created in the bytes, as if by std::start_lifetime_as_array
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return std::span<const T> {reinterpret_cast<const T*>(data.data()), static_cast<std::size_t>(header.count)};
+}
+
+/**
+ * @brief View binary serialized values in place, byte swapping them first if they were written with another byte
+ * order. The header is updated to the new byte order, so the bytes can be viewed again.
+ *
+ * @throws std::invalid_argument see the overload for const bytes
+ */
+template<binary_serializable T>
+[[nodiscard]]
+auto view_binary(std::span<std::byte> bytes) -> std::span<T>
+{
+    auto [header, data] = stronk_details::parse_binary<T>(bytes);
+    if (header.is_big_endian() != stronk_details::native_is_big_endian()) {
+        header.flags ^= binary_header::big_endian_flag;
+        if (header.has_checksum()) {
+            header.checksum = 0;  // the checksum is of the stored bytes
+            header.flags ^= binary_header::checksum_flag;
+        }
+        const auto header_bytes = header.to_bytes();
+        std::memcpy(bytes.data(), header_bytes.data(), header_bytes.size());
+        stronk_details::byteswap_elements<sizeof(T)>(bytes.subspan(binary_header::size, data.size()));
+    }
+    auto* values = bytes.subspan(binary_header::size).data();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return std::span<T> {reinterpret_cast<T*>(values), static_cast<std::size_t>(header.count)};
+}
+
+/**
+ * @brief Read binary serialized values from a stream, in reads of up to 1 MiB. The values are allocated as they are
+ * read rather than all at once, as the count of the header cannot be trusted before the values are there.
+ *
+ * @throws std::invalid_argument if the header does not match T, the stream ends early or the checksum does not match
+ */
+template<binary_serializable T>
+[[nodiscard]]
+auto read_binary(std::istream& in) -> std::vector<T>
+{
+    auto header_bytes = std::array<std::byte, binary_header::size> {};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (!in.read(reinterpret_cast<char*>(header_bytes.data()), static_cast<std::streamsize>(header_bytes.size()))) {
+        throw std::invalid_argument("not enough bytes for a stronk binary header");
+    }
+    const auto header = binary_header::from_bytes(header_bytes);
+    if (header.fingerprint != binary_fingerprint<T>() || header.element_size != sizeof(T)) {
+        throw std::invalid_argument("the binary values are of another type");
+    }
+
+    constexpr auto chunk_count = std::max(std::size_t {1}, (std::size_t {1} << 20U) / sizeof(T));
+    auto values = std::vector<T> {};
+    while (values.size() < header.count) {
+        const auto read_count = values.size();
+        const auto chunk_size = std::min<std::uint64_t>(header.count - read_count, chunk_count);
+        values.resize(read_count + static_cast<std::size_t>(chunk_size));
+        const auto chunk = std::as_writable_bytes(std::span {values}.subspan(read_count));
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        if (!in.read(reinterpret_cast<char*>(chunk.data()), static_cast<std::streamsize>(chunk.size()))) {
+            throw std::invalid_argument("the stream ended before all the binary values were read");
+        }
+    }
+    const auto bytes = std::as_writable_bytes(std::span {values});
+    if (header.has_checksum() && stronk_details::crc32c(bytes) != header.checksum) {
+        throw std::invalid_argument("the checksum of the binary values does not match");
+    }
+    if (header.is_big_endian() != stronk_details::native_is_big_endian()) {
+        stronk_details::byteswap_elements<sizeof(T)>(bytes);
+    }
+    return values;
+}
+
+namespace stronk_details
+{
+
+template<typename T>
+auto parse_binary(std::span<const std::byte> bytes, bool verify_checksum)
+    -> std::pair<binary_header, std::span<const std::byte>>
+{
+    const auto header = binary_header::from_bytes(bytes);
+    if (header.fingerprint != binary_fingerprint<T>() || header.element_size != sizeof(T)) {
+        throw std::invalid_argument("the binary values are of another type");
+    }
+    if (header.count > (bytes.size() - binary_header::size) / sizeof(T)) {
+        throw std::invalid_argument("not enough bytes for all the binary values");
+    }
+    const auto data = bytes.subspan(binary_header::size, header.data_size());
+    if (reinterpret_cast<std::uintptr_t>(data.data()) % alignof(T) != 0) {  // NOLINT
+        throw std::invalid_argument("the binary values are not aligned for their type");
+    }
+    if (verify_checksum && header.has_checksum() && crc32c(data) != header.checksum) {
+        throw std::invalid_argument("the checksum of the binary values does not match");
+    }
+    return {header, data};
+}
+
+}  // namespace stronk_details
+
+}  // namespace twig
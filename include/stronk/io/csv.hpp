@@ -0,0 +1,399 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <numeric>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "stronk/io/mapped_series.hpp"
+#include "stronk/prefabs/stronk_soa.hpp"
+#include "stronk/skills/can_parse.hpp"
+
+namespace twig
+{
+
+struct csv_options
+{
+    char delimiter = ',';
+    bool has_header = true;
+    // the number of threads to parse with, or 0 for std::thread::hardware_concurrency()
+    std::size_t threads = 0;
+    // the least number of bytes parsed by each thread, so small files are not split into chunks
+    std::size_t min_chunk_size = std::size_t {1} << 20U;
+};
+
+namespace stronk_details
+{
+
+constexpr auto trim_csv_field(std::string_view field) noexcept -> std::string_view
+{
+    while (!field.empty() && (field.front() == ' ' || field.front() == '\t')) {
+        field.remove_prefix(1);
+    }
+    while (!field.empty() && (field.back() == ' ' || field.back() == '\t' || field.back() == '\r')) {
+        field.remove_suffix(1);
+    }
+    return field;
+}
+
+// Splits the text into about count chunks of whole lines
+inline auto split_csv_chunks(std::string_view text, std::size_t count) -> std::vector<std::string_view>
+{
+    auto chunks = std::vector<std::string_view> {};
+    const auto chunk_size = (text.size() / std::max(count, std::size_t {1})) + 1;
+    while (!text.empty()) {
+        auto end = text.find('\n', std::min(chunk_size, text.size()) - 1);
+        end = end == std::string_view::npos ? text.size() : end + 1;
+        chunks.push_back(text.substr(0, end));
+        text.remove_prefix(end);
+    }
+    return chunks;
+}
+
+// Removes the first line from the text, returning it without its '\n'
+constexpr auto pop_csv_line(std::string_view& text) noexcept -> std::string_view
+{
+    const auto line_end = std::min(text.find('\n'), text.size());
+    const auto line = text.substr(0, line_end);
+    text.remove_prefix(std::min(line_end + 1, text.size()));
+    return line;
+}
+
+// The number of rows in the chunk of lines, i.e. its lines which are not empty
+constexpr auto count_csv_rows(std::string_view text) noexcept -> std::size_t
+{
+    auto rows = std::size_t {0};
+    while (!text.empty()) {
+        if (!trim_csv_field(pop_csv_line(text)).empty()) {
+            rows++;
+        }
+    }
+    return rows;
+}
+
+// Runs work(i) for each of the count chunks, on a thread each when there is more than one, and rethrows the first
+// exception thrown by any of them
+template<typename WorkT>
+void run_csv_chunks(std::size_t count, const WorkT& work)
+{
+    auto exceptions = std::vector<std::exception_ptr>(count);
+    auto run_chunk = [&](std::size_t i)
+    {
+        try {
+            work(i);
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+    };
+    if (count == 1) {
+        run_chunk(0);
+    } else {
+        auto workers = std::vector<std::thread> {};
+        workers.reserve(count);
+        for (auto i = std::size_t {0}; i < count; i++) {
+            workers.emplace_back(run_chunk, i);
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    for (const auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+// How many lines of a chunk were parsed, and why parsing failed if it did
+struct csv_chunk
+{
+    std::size_t lines = 0;
+    std::optional<std::string> error;  // the reason parsing failed on the last line
+};
+
+template<typename T>
+auto parse_csv_field(std::string_view field, std::size_t column, T& out, std::optional<std::string>& error) -> bool
+{
+    auto value = underlying_or_self_t<T> {};
+    if (from_chars_exact(field, value) != std::errc {}) {
+        error = "'" + std::string(field) + "' in column " + std::to_string(column) + " is not a valid number";
+        return false;
+    }
+    out = T {value};
+    return true;
+}
+
+// Parses the rows of the chunk straight into the columns, which must have room for count_csv_rows(text) values
+template<typename... ColumnTs>
+auto parse_csv_chunk(std::string_view text,
+                     const std::array<std::size_t, sizeof...(ColumnTs)>& column_indices,
+                     char delimiter,
+                     const std::tuple<std::span<ColumnTs>...>& columns) -> csv_chunk
+{
+    auto chunk = csv_chunk {};
+    const auto last_column = *std::ranges::max_element(column_indices);
+    auto fields = std::array<std::string_view, sizeof...(ColumnTs)> {};
+    auto row = std::size_t {0};
+
+    while (!text.empty()) {
+        const auto line = pop_csv_line(text);
+        chunk.lines++;
+        if (trim_csv_field(line).empty()) {
+            continue;
+        }
+
+        auto rest = std::optional {line};  // nullopt after the last field of the line
+        for (auto column = std::size_t {0}; column <= last_column; column++) {
+            if (!rest.has_value()) {
+                chunk.error = "there is no column " + std::to_string(column);
+                return chunk;
+            }
+            const auto field_end = rest->find(delimiter);
+            const auto field = trim_csv_field(rest->substr(0, field_end));
+            rest = field_end == std::string_view::npos ? std::nullopt : std::optional {rest->substr(field_end + 1)};
+            for (auto i = std::size_t {0}; i < fields.size(); i++) {
+                if (column_indices[i] == column) {
+                    fields[i] = field;
+                }
+            }
+        }
+
+        const auto parse_fields = [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            return (parse_csv_field(fields[Is], column_indices[Is], std::get<Is>(columns)[row], chunk.error) && ...);
+        };
+        if (!parse_fields(std::index_sequence_for<ColumnTs...> {})) {
+            return chunk;
+        }
+        row++;
+    }
+    return chunk;
+}
+
+}  // namespace stronk_details
+
+/**
+ * @brief Parse columns of CSV text directly into the typed columns of a stronk_soa, parsing chunks of lines in
+ * parallel with std::from_chars. The rows of each chunk are counted first, so the columns are allocated once and each
+ * chunk writes its values straight into its own part of them.
+ *
+ * Fields are split on the delimiter and trimmed of spaces, tabs and `\r`. Quoted fields are not supported, and empty
+ * lines are skipped.
+ *
+ * @param column_indices the (0 based) index of the CSV column of each of the ColumnTs
+ * @throws std::invalid_argument with the line number if a line is missing a column or a field cannot be parsed
+ */
+template<parsable... ColumnTs>
+[[nodiscard]]
+auto parse_csv(std::string_view text,
+               const std::array<std::size_t, sizeof...(ColumnTs)>& column_indices,
+               const csv_options& options = {}) -> stronk_soa<ColumnTs...>
+{
+    auto header_lines = std::size_t {0};
+    if (options.has_header) {
+        const auto header_end = text.find('\n');
+        text.remove_prefix(header_end == std::string_view::npos ? text.size() : header_end + 1);
+        header_lines = 1;
+    }
+
+    const auto threads = options.threads != 0 ? options.threads : std::max(std::thread::hardware_concurrency(), 1U);
+    const auto chunk_count = std::clamp(text.size() / std::max(options.min_chunk_size, std::size_t {1}),
+                                        std::size_t {1},
+                                        static_cast<std::size_t>(threads));
+    const auto texts = stronk_details::split_csv_chunks(text, chunk_count);
+
+    // count the rows of each chunk first, so every chunk can parse straight into its own part of the columns
+    auto rows = std::vector<std::size_t>(texts.size());
+    stronk_details::run_csv_chunks(texts.size(),
+                                   [&](std::size_t i) { rows[i] = stronk_details::count_csv_rows(texts[i]); });
+    auto offsets = std::vector<std::size_t>(texts.size());
+    std::exclusive_scan(rows.begin(), rows.end(), offsets.begin(), std::size_t {0});
+
+    auto result = stronk_soa<ColumnTs...> {};
+    result.resize(texts.empty() ? 0 : offsets.back() + rows.back());
+    auto chunks = std::vector<stronk_details::csv_chunk>(texts.size());
+    stronk_details::run_csv_chunks(
+        texts.size(),
+        [&](std::size_t i)
+        {
+            const auto columns = std::tuple {result.template column<ColumnTs>().subspan(offsets[i], rows[i])...};
+            chunks[i] =
+                stronk_details::parse_csv_chunk<ColumnTs...>(texts[i], column_indices, options.delimiter, columns);
+        });
+
+    auto lines = header_lines;
+    for (const auto& chunk : chunks) {
+        lines += chunk.lines;
+        if (chunk.error.has_value()) {
+            throw std::invalid_argument("line " + std::to_string(lines) + ": " + *chunk.error);
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Read columns of a CSV file into a stronk_soa, see parse_csv. The file is memory mapped rather than read.
+ *
+ * @throws std::system_error if the file cannot be opened or mapped
+ */
+template<parsable... ColumnTs>
+[[nodiscard]]
+auto read_csv(const std::filesystem::path& path,
+              const std::array<std::size_t, sizeof...(ColumnTs)>& column_indices,
+              const csv_options& options = {}) -> stronk_soa<ColumnTs...>
+{
+    const auto file = stronk_details::mapped_file {path};
+    file.advise(mapped_access::sequential);
+    const auto bytes = file.bytes();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return parse_csv<ColumnTs...>(std::string_view {reinterpret_cast<const char*>(bytes.data()), bytes.size()},
+                                  column_indices,
+                                  options);
+}
+
+/**
+ * @brief Writes columns of stronk values as delimited text through a large reusable buffer, which is written to the
+ * stream in blocks. Values are formatted with std::to_chars, floating points in their shortest round trip form.
+ */
+class csv_writer
+{
+  public:
+    explicit csv_writer(std::ostream& out, char delimiter = ',', std::size_t buffer_size = std::size_t {1} << 20U)
+        : _out(&out)
+        , _delimiter(delimiter)
+        , _buffer(std::max(buffer_size, 2 * max_field_size))
+    {
+    }
+
+    csv_writer(const csv_writer&) = delete;
+    csv_writer(csv_writer&&) = delete;
+    auto operator=(const csv_writer&) -> csv_writer& = delete;
+    auto operator=(csv_writer&&) -> csv_writer& = delete;
+
+    ~csv_writer()
+    {
+        try {
+            this->flush();
+        } catch (...) {  // NOLINT(bugprone-empty-catch) only streams with exceptions enabled throw
+        }
+    }
+
+    void write_header(std::span<const std::string_view> names)
+    {
+        for (auto i = std::size_t {0}; i < names.size(); i++) {
+            if (i != 0) {
+                this->put(this->_delimiter);
+            }
+            for (auto c : names[i]) {
+                this->put(c);
+            }
+        }
+        this->put('\n');
+    }
+
+    /**
+     * @brief Write a line for each row of the columns.
+     *
+     * @throws std::invalid_argument if the columns are not of the same size
+     */
+    template<parsable... ColumnTs>
+    void write_rows(std::span<const ColumnTs>... columns)
+    {
+        static_assert(sizeof...(ColumnTs) > 0, "write_rows needs at least one column");
+        const auto rows = std::get<0>(std::tuple {columns.size()...});
+        if (((columns.size() != rows) || ...)) {
+            throw std::invalid_argument("the columns written to a csv must be of the same size");
+        }
+        // a row is formatted directly into the buffer, so the buffer must fit the widest possible row and its newline
+        constexpr auto max_row_size = sizeof...(ColumnTs) * max_field_size + 1;
+        if (this->_buffer.size() < max_row_size) {
+            this->flush();
+            this->_buffer.resize(max_row_size);
+        }
+        for (auto row = std::size_t {0}; row < rows; row++) {
+            if (this->_buffer.size() - this->_size < max_row_size) {
+                this->flush();
+            }
+            auto first = true;
+            ((this->write_field(columns[row], std::exchange(first, false))), ...);
+            this->_buffer[this->_size++] = '\n';
+        }
+    }
+
+    // Writes the buffered text to the stream
+    void flush()
+    {
+        this->_out->write(this->_buffer.data(), static_cast<std::streamsize>(this->_size));
+        this->_size = 0;
+    }
+
+  private:
+    // the longest std::to_chars output of any arithmetic type, plus the delimiter
+    constexpr static auto max_field_size = std::size_t {64};
+
+    std::ostream* _out;
+    char _delimiter;
+    std::vector<char> _buffer;
+    std::size_t _size = 0;
+
+    void put(char c)
+    {
+        if (this->_size == this->_buffer.size()) {
+            this->flush();
+        }
+        this->_buffer[this->_size++] = c;
+    }
+
+    template<typename T>
+    void write_field(const T& value, bool first) noexcept
+    {
+        if (!first) {
+            this->_buffer[this->_size++] = this->_delimiter;
+        }
+        const auto& underlying = [&value]() -> const auto&
+        {
+            if constexpr (stronk_like<T>) {
+                return value.template unwrap<T>();
+            } else {
+                return value;
+            }
+        }();
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto* begin = this->_buffer.data() + this->_size;
+        auto* end = this->_buffer.data() + this->_buffer.size();
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        this->_size += static_cast<std::size_t>(std::to_chars(begin, end, underlying).ptr - begin);
+    }
+};
+
+/**
+ * @brief Write the columns of the stronk_soa as CSV, optionally after a header line, see csv_writer.
+ */
+template<parsable... ColumnTs>
+void write_csv(std::ostream& out,
+               const stronk_soa<ColumnTs...>& soa,
+               const std::array<std::string_view, sizeof...(ColumnTs)>& header = {},
+               char delimiter = ',')
+{
+    auto writer = csv_writer {out, delimiter};
+    if (std::ranges::any_of(header, [](std::string_view name) { return !name.empty(); })) {
+        writer.write_header(header);
+    }
+    writer.write_rows(soa.template column<ColumnTs>()...);
+}
+
+}  // namespace twig
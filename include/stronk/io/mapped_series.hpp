@@ -0,0 +1,344 @@
+#pragma once
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "stronk/io/binary.hpp"
+#include "stronk/unit.hpp"
+
+#if defined(_WIN32)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace twig
+{
+
+// How the pages of a memory mapped file are going to be accessed, passed on to the OS as a hint
+enum class mapped_access : std::uint8_t
+{
+    normal,
+    sequential,  // read ahead aggressively, and drop pages soon after they are read
+    random,  // do not read ahead
+    will_need,  // start reading in the whole file now
+};
+
+namespace stronk_details
+{
+
+/**
+ * @brief A read-only memory mapping of a whole file. Pages are only read from the file when first accessed.
+ */
+class mapped_file
+{
+  public:
+    mapped_file() = default;
+
+    // @throws std::system_error if the file cannot be opened or mapped
+    explicit mapped_file(const std::filesystem::path& path)
+    {
+#if defined(_WIN32)
+        auto* file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                   FILE_ATTRIBUTE_NORMAL, nullptr);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast,performance-no-int-to-ptr)
+        if (file == INVALID_HANDLE_VALUE) {
+            throw last_error("could not open " + path.string());
+        }
+        auto size = LARGE_INTEGER {};
+        if (::GetFileSizeEx(file, &size) == 0) {
+            auto error = last_error("could not get the size of " + path.string());
+            ::CloseHandle(file);
+            throw error;
+        }
+        this->_size = static_cast<std::size_t>(size.QuadPart);
+        if (this->_size != 0) {
+            auto* mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr) {
+                this->_data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                ::CloseHandle(mapping);  // the view keeps the mapping alive
+            }
+            if (this->_data == nullptr) {
+                auto error = last_error("could not map " + path.string());
+                ::CloseHandle(file);
+                throw error;
+            }
+        }
+        ::CloseHandle(file);
+#else
+        const auto file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+        if (file == -1) {
+            throw last_error("could not open " + path.string());
+        }
+        struct ::stat status {};
+        if (::fstat(file, &status) == -1) {
+            auto error = last_error("could not get the size of " + path.string());
+            ::close(file);
+            throw error;
+        }
+        this->_size = static_cast<std::size_t>(status.st_size);
+        if (this->_size != 0) {
+            this->_data = ::mmap(nullptr, this->_size, PROT_READ, MAP_PRIVATE, file, 0);
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast,performance-no-int-to-ptr)
+            if (this->_data == MAP_FAILED) {
+                this->_data = nullptr;
+                auto error = last_error("could not map " + path.string());
+                ::close(file);
+                throw error;
+            }
+        }
+        ::close(file);  // the mapping keeps the file alive
+#endif
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    auto operator=(const mapped_file&) -> mapped_file& = delete;
+
+    mapped_file(mapped_file&& other) noexcept
+        : _data(std::exchange(other._data, nullptr))
+        , _size(std::exchange(other._size, 0))
+    {
+    }
+
+    auto operator=(mapped_file&& other) noexcept -> mapped_file&
+    {
+        if (this != &other) {
+            this->unmap();
+            this->_data = std::exchange(other._data, nullptr);
+            this->_size = std::exchange(other._size, 0);
+        }
+        return *this;
+    }
+
+    ~mapped_file()
+    {
+        this->unmap();
+    }
+
+    [[nodiscard]]
+    auto bytes() const noexcept -> std::span<const std::byte>
+    {
+        return {static_cast<const std::byte*>(this->_data), this->_size};
+    }
+
+    // Hints the OS on how the mapped pages are going to be accessed. Hints are best effort, so failures are ignored.
+    void advise(mapped_access access) const noexcept
+    {
+        if (this->_data == nullptr) {
+            return;
+        }
+#if defined(_WIN32)
+        if (access == mapped_access::will_need) {
+            auto range = WIN32_MEMORY_RANGE_ENTRY {this->_data, this->_size};
+            ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0);
+        }
+#else
+        auto advice = MADV_NORMAL;
+        switch (access) {
+            case mapped_access::normal:
+                advice = MADV_NORMAL;
+                break;
+            case mapped_access::sequential:
+                advice = MADV_SEQUENTIAL;
+                break;
+            case mapped_access::random:
+                advice = MADV_RANDOM;
+                break;
+            case mapped_access::will_need:
+                advice = MADV_WILLNEED;
+                break;
+        }
+        ::madvise(this->_data, this->_size, advice);
+#endif
+    }
+
+  private:
+    void* _data = nullptr;
+    std::size_t _size = 0;
+
+    void unmap() noexcept
+    {
+        if (this->_data != nullptr) {
+#if defined(_WIN32)
+            ::UnmapViewOfFile(this->_data);
+#else
+            ::munmap(this->_data, this->_size);
+#endif
+            this->_data = nullptr;
+            this->_size = 0;
+        }
+    }
+
+    static auto last_error(const std::string& what) -> std::system_error
+    {
+#if defined(_WIN32)
+        return std::system_error(static_cast<int>(::GetLastError()), std::system_category(), what);
+#else
+        return std::system_error(errno, std::generic_category(), what);
+#endif
+    }
+};
+
+// The number of bytes needed after size bytes, for the next section to start at a multiple of the header size
+constexpr auto mapped_series_padding(std::size_t size) noexcept -> std::size_t
+{
+    return (binary_header::size - (size % binary_header::size)) % binary_header::size;
+}
+
+}  // namespace stronk_details
+
+/**
+ * @brief Write a time series in the format read by mapped_series: the times and then the values, each written like
+ * write_binary, with the values padded to start at a multiple of the header size from the start of the file.
+ *
+ * @throws std::invalid_argument if there are not as many times as values
+ */
+template<binary_serializable TimeT, binary_serializable ValueT>
+void write_mapped_series(std::ostream& out,
+                         std::span<const TimeT> times,
+                         std::span<const ValueT> values,
+                         binary_checksum checksum = binary_checksum::none)
+{
+    if (times.size() != values.size()) {
+        throw std::invalid_argument("a mapped series needs a time for each value");
+    }
+    write_binary(out, times, checksum);
+    const auto padding = std::array<char, binary_header::size> {};
+    out.write(padding.data(),
+              static_cast<std::streamsize>(stronk_details::mapped_series_padding(std::as_bytes(times).size())));
+    write_binary(out, values, checksum);
+}
+
+/**
+ * @brief A read-only time series of unit values, memory mapped from a file written with write_mapped_series.
+ *
+ * Opening only checks the headers of the file against the units, scales and underlying types of the series, so
+ * nothing is parsed or copied and the pages of the file are read in lazily as the times and values are accessed.
+ * Checksums are only verified when calling verify_checksums(), as that reads the whole file.
+ *
+ * @tparam TimeUnitT the unit of the times, e.g. seconds
+ * @tparam ValueUnitT the unit of the values, e.g. watt hours
+ * @tparam T the underlying type of the values
+ * @tparam TimeT the underlying type of the times
+ */
+template<unit_like TimeUnitT, unit_like ValueUnitT, typename T, typename TimeT = T>
+class mapped_series
+{
+  public:
+    using time_type = typename TimeUnitT::template value<TimeT>;
+    using value_type = typename ValueUnitT::template value<T>;
+    using size_type = std::size_t;
+
+    static_assert(binary_serializable<time_type> && binary_serializable<value_type>,
+                  "the times and values of a mapped_series must be binary_serializable");
+
+    /**
+     * @brief Map the file and check that it holds a series of these units.
+     *
+     * @throws std::system_error if the file cannot be opened or mapped
+     * @throws std::invalid_argument if the file does not hold times and values of the units, scales and underlying
+     * types of this series, in the byte order of this platform
+     */
+    explicit mapped_series(const std::filesystem::path& path, mapped_access access = mapped_access::normal)
+        : _file(path)
+    {
+        const auto bytes = this->_file.bytes();
+        const auto [time_header, time_bytes] = stronk_details::parse_binary<time_type>(bytes, false);
+        const auto values_offset =
+            binary_header::size + time_bytes.size() + stronk_details::mapped_series_padding(time_bytes.size());
+        if (values_offset > bytes.size()) {
+            throw std::invalid_argument("not enough bytes for the values of the mapped series");
+        }
+        const auto [value_header, value_bytes] =
+            stronk_details::parse_binary<value_type>(bytes.subspan(values_offset), false);
+        if (time_header.count != value_header.count) {
+            throw std::invalid_argument("the mapped series does not have a time for each value");
+        }
+        if (time_header.is_big_endian() != stronk_details::native_is_big_endian()
+            || value_header.is_big_endian() != stronk_details::native_is_big_endian())
+        {
+            throw std::invalid_argument("the mapped series was written with another byte order");
+        }
+
+        // the values are implicitly created in the mapped bytes, as if by std::start_lifetime_as_array
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+        this->_times = {reinterpret_cast<const time_type*>(time_bytes.data()),
+                        static_cast<size_type>(time_header.count)};
+        this->_values = {reinterpret_cast<const value_type*>(value_bytes.data()),
+                         static_cast<size_type>(value_header.count)};
+        // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+        this->_checksums = {time_header.has_checksum() ? std::optional {time_header.checksum} : std::nullopt,
+                            value_header.has_checksum() ? std::optional {value_header.checksum} : std::nullopt};
+        this->advise(access);
+    }
+
+    [[nodiscard]]
+    auto times() const noexcept -> std::span<const time_type>
+    {
+        return this->_times;
+    }
+
+    [[nodiscard]]
+    auto values() const noexcept -> std::span<const value_type>
+    {
+        return this->_values;
+    }
+
+    [[nodiscard]]
+    auto size() const noexcept -> size_type
+    {
+        return this->_values.size();
+    }
+
+    [[nodiscard]]
+    auto empty() const noexcept -> bool
+    {
+        return this->_values.empty();
+    }
+
+    // Hints the OS on how the series is going to be accessed, e.g. mapped_access::sequential before a full scan
+    void advise(mapped_access access) const noexcept
+    {
+        this->_file.advise(access);
+    }
+
+    /**
+     * @brief Whether the times and values match the checksums they were written with. Reads the whole file.
+     *
+     * Series written without checksums are always valid.
+     */
+    [[nodiscard]]
+    auto verify_checksums() const noexcept -> bool
+    {
+        const auto matches = [](std::span<const std::byte> bytes, std::optional<std::uint32_t> checksum)
+        { return !checksum.has_value() || stronk_details::crc32c(bytes) == *checksum; };
+        return matches(std::as_bytes(this->_times), this->_checksums.first)
+            && matches(std::as_bytes(this->_values), this->_checksums.second);
+    }
+
+  private:
+    stronk_details::mapped_file _file;
+    std::span<const time_type> _times;
+    std::span<const value_type> _values;
+    std::pair<std::optional<std::uint32_t>, std::optional<std::uint32_t>> _checksums;
+};
+
+}  // namespace twig
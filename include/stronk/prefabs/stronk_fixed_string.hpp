@@ -0,0 +1,181 @@
+#pragma once
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include "stronk/skills/can_hash.hpp"
+#include "stronk/skills/can_view.hpp"
+#include "stronk/stronk.hpp"
+#include "stronk/utilities/crc32c.hpp"
+
+namespace twig
+{
+
+/**
+ * @brief A string of at most N chars stored inline, padded with zero bytes. It is trivially copyable and can be used as
+ * a non-type template parameter. Equality, ordering and hashing work on all N bytes at once rather than char by char,
+ * which is fast for the short codes it is meant for (EIC codes, tickers, currencies). The text cannot contain '\0'.
+ */
+template<std::size_t N>
+struct fixed_string
+{
+    static_assert(N > 0, "a fixed_string needs room for at least one char");
+
+    // public to be a structural type, i.e. usable as a non-type template parameter
+    std::array<char, N> chars {};
+
+    constexpr fixed_string() noexcept = default;
+
+    /**
+     * @throws std::length_error if the text is longer than N, and std::invalid_argument if it contains '\0' (both a
+     * compile error in constant expressions)
+     */
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    constexpr explicit(false) fixed_string(std::string_view text)
+    {
+        if (text.size() > N) {
+            throw std::length_error("the text does not fit in the fixed_string");
+        }
+        for (auto i = std::size_t {0}; i < text.size(); i++) {
+            if (text[i] == '\0') {
+                throw std::invalid_argument("the text of a fixed_string cannot contain '\\0'");
+            }
+            this->chars[i] = text[i];
+        }
+    }
+
+    template<typename StringT>
+        requires(std::convertible_to<const StringT&, std::string_view> && !std::is_array_v<StringT>)
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    constexpr explicit(false) fixed_string(const StringT& text)
+        : fixed_string(std::string_view {text})
+    {
+    }
+
+    /**
+     * @brief The null terminated string in the array, i.e. its chars up to the first '\0', so a string literal of
+     * exactly N chars fits. This is the text the deduction guide sizes `fixed_string<M - 1>` for.
+     *
+     * @throws std::length_error if the string is longer than N, and std::invalid_argument if the array has no '\0'
+     * (both a compile error in constant expressions)
+     */
+    template<std::size_t M>
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions, modernize-avoid-c-arrays)
+    constexpr explicit(false) fixed_string(const char (&text)[M])
+        : fixed_string(std::string_view {text, terminated_length(text)})
+    {
+    }
+
+    // The index of the first '\0' of the array
+    template<std::size_t M>
+    [[nodiscard]]
+    constexpr static auto terminated_length(const char (&text)[M]) -> std::size_t  // NOLINT(modernize-avoid-c-arrays)
+    {
+        for (auto i = std::size_t {0}; i < M; i++) {
+            if (text[i] == '\0') {
+                return i;
+            }
+        }
+        throw std::invalid_argument("the char array of a fixed_string is not null terminated");
+    }
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> std::size_t
+    {
+        auto size = std::size_t {0};
+        while (size < N && this->chars[size] != '\0') {
+            size++;
+        }
+        return size;
+    }
+
+    [[nodiscard]]
+    constexpr auto view() const noexcept -> std::string_view
+    {
+        return std::string_view {this->chars.data(), this->size()};
+    }
+
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    constexpr explicit(false) operator std::string_view() const noexcept
+    {
+        return this->view();
+    }
+
+    [[nodiscard]]
+    constexpr auto operator==(const fixed_string& other) const noexcept -> bool
+    {
+        if (std::is_constant_evaluated()) {
+            return this->chars == other.chars;
+        }
+        return std::memcmp(this->chars.data(), other.chars.data(), N) == 0;
+    }
+
+    // Orders like the texts, as the padding bytes are smaller than any char
+    [[nodiscard]]
+    constexpr auto operator<=>(const fixed_string& other) const noexcept -> std::strong_ordering
+    {
+        if (std::is_constant_evaluated()) {
+            for (auto i = std::size_t {0}; i < N; i++) {
+                const auto lhs = static_cast<unsigned char>(this->chars[i]);
+                const auto rhs = static_cast<unsigned char>(other.chars[i]);
+                if (lhs != rhs) {
+                    return lhs <=> rhs;
+                }
+            }
+            return std::strong_ordering::equal;
+        }
+        return std::memcmp(this->chars.data(), other.chars.data(), N) <=> 0;
+    }
+
+    // Up to 8 chars are mixed as one integer, longer strings go through crc32c
+    [[nodiscard]]
+    auto hash() const noexcept -> std::size_t
+    {
+        if constexpr (N <= sizeof(std::uint64_t)) {
+            auto bits = std::uint64_t {0};
+            std::memcpy(&bits, this->chars.data(), N);
+            return static_cast<std::size_t>(stronk_details::mix64(bits));
+        } else {
+            const auto crc = stronk_details::crc32c(std::as_bytes(std::span {this->chars}));
+            return static_cast<std::size_t>(static_cast<std::uint64_t>(crc) * 0x9E3779B97F4A7C15ULL);
+        }
+    }
+};
+
+template<std::size_t M>
+fixed_string(const char (&)[M]) -> fixed_string<M - 1>;  // NOLINT(modernize-avoid-c-arrays)
+
+/**
+ * @brief A stronk string of at most N chars stored inline, e.g. `stronk_fixed_string<eic_code, 16>`. Unlike
+ * `stronk_string` it never allocates, and it can be used as a non-type template parameter. Like all stronk types it
+ * is not trivially copyable itself (see the assignment operators of stronk), but its underlying fixed_string is, so
+ * the unwrapped values can be copied with memcpy.
+ */
+template<typename Tag, std::size_t N, template<typename> typename... Skills>
+using stronk_fixed_string = stronk<Tag,
+                                   fixed_string<N>,
+                                   can_equate,
+                                   can_order,
+                                   can_size,
+                                   can_be_const_viewed_as<std::string_view>::skill,
+                                   Skills...>;
+
+}  // namespace twig
+
+template<std::size_t N>
+struct std::hash<twig::fixed_string<N>>  // NOLINT(cert-dcl58-cpp) std::hash is exempt from this rule
+{
+    [[nodiscard]]
+    auto operator()(const twig::fixed_string<N>& s) const noexcept -> std::size_t
+    {
+        return s.hash();
+    }
+};
@@ -0,0 +1,306 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "stronk/stronk.hpp"
+#include "stronk/utilities/aligned_allocator.hpp"
+#include "stronk/utilities/macros.hpp"
+
+namespace twig
+{
+
+// Stronk types wrapping an integer, usable as dense indices
+template<typename T>
+concept stronk_index_like = stronk_like<T> && std::integral<typename T::underlying_type>
+    && !std::same_as<typename T::underlying_type, bool>;
+
+namespace stronk_details
+{
+
+// The count, after checking the ids from 0 up to (not including) count all fit in the underlying type of IdT
+template<stronk_index_like IdT>
+constexpr auto checked_id_count(std::size_t count) -> std::size_t
+{
+    if (count != 0 && !std::in_range<typename IdT::underlying_type>(count - 1)) {
+        throw std::length_error("there are more values than ids of the id type");
+    }
+    return count;
+}
+
+}  // namespace stronk_details
+
+/**
+ * @brief A typed range of the ids from 0 up to (not including) size, e.g. all the ids of a stronk_index_vector.
+ *
+ * @throws std::length_error if the ids do not fit in the underlying type of IdT
+ */
+template<stronk_index_like IdT>
+[[nodiscard]]
+constexpr auto id_range(std::size_t size)
+{
+    using underlying_t = typename IdT::underlying_type;
+    return std::views::iota(std::size_t {0}, stronk_details::checked_id_count<IdT>(size))
+        | std::views::transform([](std::size_t index) { return IdT {static_cast<underlying_t>(index)}; });
+}
+
+/**
+ * @brief A vector of values indexed by a dense stronk id type rather than by size_t, like a hash map from ids to values
+ * but with O(1) lookups without hashing. Indexing with any other type, e.g. another id type, does not compile.
+ *
+ * Iterating gives `std::pair<IdT, V&>` for each value, and `gather` and `scatter` read and write the values of many ids
+ * in one loop. The values are stored contiguously and SIMD aligned. Growing it beyond the ids of IdT, e.g. past 256
+ * values for a `uint8_t` id, throws std::length_error.
+ *
+ * @tparam IdT a stronk type wrapping an integer, ids are offsets from 0
+ * @tparam V the type of the values
+ */
+template<stronk_index_like IdT, typename V>
+struct stronk_index_vector
+{
+    using id_type = IdT;
+    using value_type = V;
+    using size_type = std::size_t;
+    using container_t = std::vector<V, aligned_allocator<V>>;
+
+  private:
+    template<typename VectorT, typename ValueRefT>
+    struct basic_iterator
+    {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<IdT, ValueRefT>;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type;
+
+        VectorT* _vector = nullptr;
+        size_type _index = 0;
+
+        constexpr auto operator*() const -> reference
+        {
+            return reference {IdT {static_cast<typename IdT::underlying_type>(this->_index)},
+                              this->_vector->_values[this->_index]};
+        }
+
+        constexpr auto operator++() -> basic_iterator&
+        {
+            this->_index++;
+            return *this;
+        }
+
+        constexpr auto operator++(int) -> basic_iterator
+        {
+            auto copy = *this;
+            this->_index++;
+            return copy;
+        }
+
+        constexpr auto operator==(const basic_iterator& other) const -> bool = default;
+    };
+
+    [[nodiscard]]
+    STRONK_FORCEINLINE constexpr static auto offset(const IdT& id) noexcept -> size_type
+    {
+        return static_cast<size_type>(id.template unwrap<IdT>());
+    }
+
+    static void check_sizes(std::span<const IdT> ids, size_type values)
+    {
+        if (ids.size() != values) {
+            throw std::invalid_argument("gather and scatter need a value for each id");
+        }
+    }
+
+  public:
+    using iterator = basic_iterator<stronk_index_vector, V&>;
+    using const_iterator = basic_iterator<const stronk_index_vector, const V&>;
+
+    constexpr stronk_index_vector() = default;
+
+    constexpr explicit stronk_index_vector(size_type size)
+        : _values(stronk_details::checked_id_count<IdT>(size))
+    {
+    }
+
+    constexpr stronk_index_vector(size_type size, const V& value)
+        : _values(stronk_details::checked_id_count<IdT>(size), value)
+    {
+    }
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type
+    {
+        return this->_values.size();
+    }
+
+    [[nodiscard]]
+    constexpr auto empty() const noexcept -> bool
+    {
+        return this->_values.empty();
+    }
+
+    constexpr void reserve(size_type capacity)
+    {
+        this->_values.reserve(capacity);
+    }
+
+    constexpr void resize(size_type size)
+    {
+        stronk_details::checked_id_count<IdT>(size);
+        this->_values.resize(size);
+    }
+
+    constexpr void clear() noexcept
+    {
+        this->_values.clear();
+    }
+
+    // Appends the value, returning the id it was given
+    constexpr auto push_back(const V& value) -> IdT
+    {
+        stronk_details::checked_id_count<IdT>(this->_values.size() + 1);
+        this->_values.push_back(value);
+        return IdT {static_cast<typename IdT::underlying_type>(this->_values.size() - 1)};
+    }
+
+    [[nodiscard]]
+    STRONK_FORCEINLINE constexpr auto operator[](const IdT& id) noexcept -> V&
+    {
+        return this->_values[offset(id)];
+    }
+
+    [[nodiscard]]
+    STRONK_FORCEINLINE constexpr auto operator[](const IdT& id) const noexcept -> const V&
+    {
+        return this->_values[offset(id)];
+    }
+
+    [[nodiscard]]
+    constexpr auto contains(const IdT& id) const noexcept -> bool
+    {
+        const auto& value = id.template unwrap<IdT>();
+        return std::cmp_greater_equal(value, 0) && std::cmp_less(value, this->size());
+    }
+
+    [[nodiscard]]
+    constexpr auto at(const IdT& id) -> V&
+    {
+        if (!this->contains(id)) {
+            throw std::out_of_range("stronk_index_vector id out of range");
+        }
+        return (*this)[id];
+    }
+
+    [[nodiscard]]
+    constexpr auto at(const IdT& id) const -> const V&
+    {
+        if (!this->contains(id)) {
+            throw std::out_of_range("stronk_index_vector id out of range");
+        }
+        return (*this)[id];
+    }
+
+    // The ids of all the values, in order
+    [[nodiscard]]
+    constexpr auto ids() const
+    {
+        return id_range<IdT>(this->size());
+    }
+
+    [[nodiscard]]
+    constexpr auto values() noexcept -> std::span<V>
+    {
+        return this->_values;
+    }
+
+    [[nodiscard]]
+    constexpr auto values() const noexcept -> std::span<const V>
+    {
+        return this->_values;
+    }
+
+    /**
+     * @brief Reads the value of each of the ids into out, in a loop the compiler may vectorize with gather
+     * instructions. The ids must be less than size().
+     *
+     * @throws std::invalid_argument if out is not of the same size as ids, or if out overlaps the values, as the loop
+     * is vectorized on the promise that writing out never changes the values it reads
+     */
+    constexpr void gather(std::span<const IdT> ids, std::span<V> out) const
+    {
+        check_sizes(ids, out.size());
+        const auto* values = this->_values.data();
+        if (!std::is_constant_evaluated()) {
+            const auto before = std::less<const V*> {};
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            if (before(out.data(), values + this->size()) && before(values, out.data() + out.size())) {
+                throw std::invalid_argument("gather cannot write into the values it reads");
+            }
+        }
+        const auto size = ids.size();
+        STRONK_VECTORIZE_LOOP
+        for (auto i = size_type {0}; i < size; ++i) {
+            out[i] = values[offset(ids[i])];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+    }
+
+    [[nodiscard]]
+    constexpr auto gather(std::span<const IdT> ids) const -> std::vector<V>
+    {
+        auto out = std::vector<V>(ids.size());
+        this->gather(ids, std::span<V> {out});
+        return out;
+    }
+
+    /**
+     * @brief Writes each of the values to the value of its id. If an id appears more than once the last of its values
+     * is kept. The ids must be less than size().
+     *
+     * @throws std::invalid_argument if values is not of the same size as ids
+     */
+    constexpr void scatter(std::span<const IdT> ids, std::span<const V> values)
+    {
+        check_sizes(ids, values.size());
+        auto* out = this->_values.data();
+        const auto size = ids.size();
+        // not marked with STRONK_VECTORIZE_LOOP, as repeated ids do depend on the order of the writes
+        for (auto i = size_type {0}; i < size; ++i) {
+            out[offset(ids[i])] = values[i];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() noexcept -> iterator
+    {
+        return iterator {this, 0};
+    }
+
+    [[nodiscard]]
+    constexpr auto end() noexcept -> iterator
+    {
+        return iterator {this, this->size()};
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() const noexcept -> const_iterator
+    {
+        return const_iterator {this, 0};
+    }
+
+    [[nodiscard]]
+    constexpr auto end() const noexcept -> const_iterator
+    {
+        return const_iterator {this, this->size()};
+    }
+
+  private:
+    container_t _values;
+};
+
+}  // namespace twig
@@ -0,0 +1,177 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "stronk/skills/can_hash.hpp"
+#include "stronk/skills/can_view.hpp"
+#include "stronk/stronk.hpp"
+
+namespace twig
+{
+
+namespace stronk_details
+{
+
+// An interned string. Entries are never modified after being published in the pool
+struct interned_entry
+{
+    std::size_t hash;
+    std::string text;
+    const interned_entry* next;
+};
+
+/**
+ * @brief The set of all interned strings. Looking up an interned string never locks: the buckets are lists of
+ * immutable entries, whose heads are published with release stores. Only interning a new string takes the mutex.
+ */
+class intern_pool
+{
+    constexpr static auto bucket_count = std::size_t {4096};
+
+    std::array<std::atomic<const interned_entry*>, bucket_count> _buckets {};
+    std::mutex _insert_mutex;
+    std::vector<std::unique_ptr<interned_entry>> _entries;
+
+    [[nodiscard]]
+    static auto find(const std::atomic<const interned_entry*>& bucket, std::size_t hash, std::string_view text) noexcept
+        -> const interned_entry*
+    {
+        for (const auto* entry = bucket.load(std::memory_order_acquire); entry != nullptr; entry = entry->next) {
+            if (entry->hash == hash && entry->text == text) {
+                return entry;
+            }
+        }
+        return nullptr;
+    }
+
+  public:
+    [[nodiscard]]
+    auto intern(std::string_view text) -> const interned_entry*
+    {
+        const auto hash = crc32c_hash_policy {}(text);
+        auto& bucket = this->_buckets[hash % bucket_count];
+        if (const auto* found = find(bucket, hash, text); found != nullptr) {
+            return found;
+        }
+
+        auto lock = std::scoped_lock {this->_insert_mutex};
+        // another thread may have interned it while we waited for the lock
+        if (const auto* found = find(bucket, hash, text); found != nullptr) {
+            return found;
+        }
+        auto entry = std::make_unique<interned_entry>(
+            interned_entry {hash, std::string {text}, bucket.load(std::memory_order_relaxed)});
+        const auto* published = entry.get();
+        this->_entries.push_back(std::move(entry));
+        bucket.store(published, std::memory_order_release);
+        return published;
+    }
+};
+
+// Leaked on purpose, so interned strings stay valid in the destructors of other static objects too
+inline auto global_intern_pool() -> intern_pool&
+{
+    static auto* pool = new intern_pool {};  // NOLINT(cppcoreguidelines-owning-memory)
+    return *pool;
+}
+
+}  // namespace stronk_details
+
+/**
+ * @brief A pointer to a string in the global intern pool. Equal strings are interned to the same pointer, so copying,
+ * comparing and hashing are O(1), and the hash is computed once when the string is interned. Interned strings are kept
+ * for the lifetime of the program, so only intern a bounded vocabulary, e.g. instrument or area codes. Constructing one
+ * from text interns it, which is a lock free lookup when the text is already interned.
+ */
+class interned_string
+{
+    const stronk_details::interned_entry* _entry;
+
+    [[nodiscard]]
+    static auto empty_entry() -> const stronk_details::interned_entry*
+    {
+        static const auto* entry = stronk_details::global_intern_pool().intern(std::string_view {});
+        return entry;
+    }
+
+  public:
+    interned_string()
+        : _entry(empty_entry())
+    {
+    }
+
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    explicit(false) interned_string(std::string_view text)
+        : _entry(stronk_details::global_intern_pool().intern(text))
+    {
+    }
+
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    explicit(false) interned_string(const std::string& text)
+        : interned_string(std::string_view {text})
+    {
+    }
+
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    explicit(false) interned_string(const char* text)
+        : interned_string(std::string_view {text})
+    {
+    }
+
+    [[nodiscard]]
+    auto view() const noexcept -> std::string_view
+    {
+        return this->_entry->text;
+    }
+
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    explicit(false) operator std::string_view() const noexcept
+    {
+        return this->view();
+    }
+
+    [[nodiscard]]
+    auto size() const noexcept -> std::size_t
+    {
+        return this->_entry->text.size();
+    }
+
+    [[nodiscard]]
+    auto hash() const noexcept -> std::size_t
+    {
+        return this->_entry->hash;
+    }
+
+    auto operator==(const interned_string& other) const noexcept -> bool = default;
+};
+
+static_assert(std::is_trivially_copyable_v<interned_string>);
+static_assert(sizeof(interned_string) == sizeof(void*));
+
+/**
+ * @brief A stronk string for small, repeating vocabularies such as instrument or area codes, backed by
+ * `interned_string`: it is pointer-sized, and equality and std::hash are O(1).
+ */
+template<typename Tag, template<typename> typename... Skills>
+using stronk_interned_string =
+    stronk<Tag, interned_string, can_equate, can_size, can_be_const_viewed_as<std::string_view>::skill, Skills...>;
+
+}  // namespace twig
+
+template<>
+struct std::hash<twig::interned_string>  // NOLINT(cert-dcl58-cpp) std::hash is exempt from this rule
+{
+    [[nodiscard]]
+    auto operator()(const twig::interned_string& s) const noexcept -> std::size_t
+    {
+        return s.hash();
+    }
+};
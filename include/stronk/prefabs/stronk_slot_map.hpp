@@ -0,0 +1,293 @@
+#pragma once
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "stronk/stronk.hpp"
+#include "stronk/utilities/aligned_allocator.hpp"
+
+namespace twig
+{
+
+// Stronk types wrapping an unsigned integer, usable as handles of a stronk_slot_map
+template<typename T>
+concept stronk_handle_like = stronk_like<T> && std::unsigned_integral<typename T::underlying_type>
+    && !std::same_as<typename T::underlying_type, bool>;
+
+/**
+ * @brief A container of objects which are often inserted and erased, e.g. live orders, giving out handles rather than
+ * keys. Inserting, erasing and looking up are O(1) without hashing, and the objects are stored densely (in no
+ * particular order) so iterating is a scan of a vector.
+ *
+ * A handle packs the index of its slot in the lower half of its bits and the generation of the slot in the upper half.
+ * Erasing bumps the generation of the slot, so handles to erased objects are detected as stale even when the slot is
+ * reused. Generations start at 1, so a handle of 0 is never valid.
+ *
+ * @tparam HandleT a stronk type wrapping an unsigned integer, e.g. `stronk<order_handle, uint64_t, can_equate>`
+ * @tparam T the type of the objects
+ */
+template<stronk_handle_like HandleT, typename T>
+struct stronk_slot_map
+{
+    using handle_type = HandleT;
+    using value_type = T;
+    using size_type = std::size_t;
+    using bits_t = typename HandleT::underlying_type;
+    using container_t = std::vector<T, aligned_allocator<T>>;
+    using iterator = typename container_t::iterator;
+    using const_iterator = typename container_t::const_iterator;
+
+    constexpr static auto index_bits = std::numeric_limits<bits_t>::digits / 2;
+    constexpr static auto index_mask = static_cast<bits_t>((bits_t {1} << index_bits) - 1U);
+
+  private:
+    struct slot
+    {
+        bits_t dense_index;
+        bits_t generation;
+    };
+
+    std::vector<slot> _slots;
+    std::vector<bits_t> _free_slots;
+    container_t _values;
+    std::vector<bits_t> _dense_to_slot;
+
+    [[nodiscard]]
+    constexpr static auto make_handle(bits_t index, bits_t generation) noexcept -> HandleT
+    {
+        return HandleT {static_cast<bits_t>(static_cast<bits_t>(generation << index_bits) | index)};
+    }
+
+    // The slot of the handle, or nullptr if the handle is stale or was never given out
+    [[nodiscard]]
+    constexpr auto find_slot(const HandleT& handle) const noexcept -> const slot*
+    {
+        const auto index = index_of(handle);
+        if (index >= this->_slots.size() || this->_slots[index].generation != generation_of(handle)) {
+            return nullptr;
+        }
+        return &this->_slots[index];
+    }
+
+    [[nodiscard]]
+    constexpr auto acquire_slot() -> bits_t
+    {
+        if (!this->_free_slots.empty()) {
+            const auto index = this->_free_slots.back();
+            this->_free_slots.pop_back();
+            return index;
+        }
+        if (this->_slots.size() > index_mask) {
+            throw std::length_error("stronk_slot_map has no more slots for its handle type");
+        }
+        this->_slots.push_back(slot {0, 1});
+        return static_cast<bits_t>(this->_slots.size() - 1);
+    }
+
+  public:
+    [[nodiscard]]
+    constexpr static auto index_of(const HandleT& handle) noexcept -> bits_t
+    {
+        return static_cast<bits_t>(handle.template unwrap<HandleT>() & index_mask);
+    }
+
+    [[nodiscard]]
+    constexpr static auto generation_of(const HandleT& handle) noexcept -> bits_t
+    {
+        return static_cast<bits_t>(handle.template unwrap<HandleT>() >> index_bits);
+    }
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type
+    {
+        return this->_values.size();
+    }
+
+    [[nodiscard]]
+    constexpr auto empty() const noexcept -> bool
+    {
+        return this->_values.empty();
+    }
+
+    constexpr void reserve(size_type capacity)
+    {
+        this->_slots.reserve(capacity);
+        this->_values.reserve(capacity);
+        this->_dense_to_slot.reserve(capacity);
+    }
+
+    // Erases all objects, invalidating all handles given out so far
+    constexpr void clear()
+    {
+        while (!this->_values.empty()) {
+            this->erase(this->handle_at(this->size() - 1));
+        }
+    }
+
+    template<typename... Args>
+    constexpr auto emplace(Args&&... args) -> HandleT
+    {
+        const auto index = this->acquire_slot();
+        try {
+            // grown first, so the push_back below cannot throw after the value was added. Growing geometrically keeps
+            // inserts O(1), as reserve allocates exactly what it is asked for
+            if (this->_dense_to_slot.size() == this->_dense_to_slot.capacity()) {
+                this->_dense_to_slot.reserve(std::max<size_type>(1, 2 * this->_dense_to_slot.capacity()));
+            }
+            this->_values.emplace_back(std::forward<Args>(args)...);
+        } catch (...) {
+            this->_free_slots.push_back(index);
+            throw;
+        }
+        this->_dense_to_slot.push_back(index);
+        auto& new_slot = this->_slots[index];
+        new_slot.dense_index = static_cast<bits_t>(this->_values.size() - 1);
+        return make_handle(index, new_slot.generation);
+    }
+
+    constexpr auto insert(const T& value) -> HandleT
+    {
+        return this->emplace(value);
+    }
+
+    constexpr auto insert(T&& value) -> HandleT
+    {
+        return this->emplace(std::move(value));
+    }
+
+    /**
+     * @brief Erases the object of the handle by moving the last object into its place.
+     *
+     * @return false if the handle was stale, in which case nothing is erased
+     */
+    constexpr auto erase(const HandleT& handle) -> bool
+    {
+        const auto* found = this->find_slot(handle);
+        if (found == nullptr) {
+            return false;
+        }
+        const auto index = index_of(handle);
+        const auto dense_index = found->dense_index;
+        const auto last_slot = this->_dense_to_slot.back();
+        if (dense_index != this->_values.size() - 1) {
+            this->_values[dense_index] = std::move(this->_values.back());
+            this->_dense_to_slot[dense_index] = last_slot;
+            this->_slots[last_slot].dense_index = dense_index;
+        }
+        this->_values.pop_back();
+        this->_dense_to_slot.pop_back();
+
+        auto& erased_slot = this->_slots[index];
+        erased_slot.generation = static_cast<bits_t>((erased_slot.generation + 1U) & index_mask);
+        if (erased_slot.generation == 0) {
+            erased_slot.generation = 1;
+        }
+        this->_free_slots.push_back(index);
+        return true;
+    }
+
+    [[nodiscard]]
+    constexpr auto contains(const HandleT& handle) const noexcept -> bool
+    {
+        return this->find_slot(handle) != nullptr;
+    }
+
+    // The object of the handle, or nullptr if the handle is stale
+    [[nodiscard]]
+    constexpr auto find(const HandleT& handle) noexcept -> T*
+    {
+        const auto* found = this->find_slot(handle);
+        return found == nullptr ? nullptr : &this->_values[found->dense_index];
+    }
+
+    [[nodiscard]]
+    constexpr auto find(const HandleT& handle) const noexcept -> const T*
+    {
+        const auto* found = this->find_slot(handle);
+        return found == nullptr ? nullptr : &this->_values[found->dense_index];
+    }
+
+    // Unchecked lookup, the handle must not be stale
+    [[nodiscard]]
+    constexpr auto operator[](const HandleT& handle) noexcept -> T&
+    {
+        return this->_values[this->_slots[index_of(handle)].dense_index];
+    }
+
+    [[nodiscard]]
+    constexpr auto operator[](const HandleT& handle) const noexcept -> const T&
+    {
+        return this->_values[this->_slots[index_of(handle)].dense_index];
+    }
+
+    [[nodiscard]]
+    constexpr auto at(const HandleT& handle) -> T&
+    {
+        auto* found = this->find(handle);
+        if (found == nullptr) {
+            throw std::out_of_range("stronk_slot_map handle is stale");
+        }
+        return *found;
+    }
+
+    [[nodiscard]]
+    constexpr auto at(const HandleT& handle) const -> const T&
+    {
+        const auto* found = this->find(handle);
+        if (found == nullptr) {
+            throw std::out_of_range("stronk_slot_map handle is stale");
+        }
+        return *found;
+    }
+
+    // The handle of the object at the position in the dense storage, e.g. while iterating values()
+    [[nodiscard]]
+    constexpr auto handle_at(size_type dense_index) const noexcept -> HandleT
+    {
+        const auto index = this->_dense_to_slot[dense_index];
+        return make_handle(index, this->_slots[index].generation);
+    }
+
+    [[nodiscard]]
+    constexpr auto values() noexcept -> std::span<T>
+    {
+        return this->_values;
+    }
+
+    [[nodiscard]]
+    constexpr auto values() const noexcept -> std::span<const T>
+    {
+        return this->_values;
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() noexcept -> iterator
+    {
+        return this->_values.begin();
+    }
+
+    [[nodiscard]]
+    constexpr auto end() noexcept -> iterator
+    {
+        return this->_values.end();
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() const noexcept -> const_iterator
+    {
+        return this->_values.begin();
+    }
+
+    [[nodiscard]]
+    constexpr auto end() const noexcept -> const_iterator
+    {
+        return this->_values.end();
+    }
+};
+
+}  // namespace twig
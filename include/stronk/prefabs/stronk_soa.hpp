@@ -0,0 +1,257 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "stronk/stronk.hpp"
+#include "stronk/utilities/aligned_allocator.hpp"
+
+namespace twig
+{
+
+namespace stronk_details
+{
+
+template<typename T, typename... Ts>
+constexpr auto count_of() -> std::size_t
+{
+    return (std::size_t {std::is_same_v<T, Ts>} + ... + 0);
+}
+
+}  // namespace stronk_details
+
+/**
+ * @brief A structure-of-arrays container of records, where every field is stored in its own SIMD aligned column.
+ *
+ * Each field is identified by its (stronk) type, so the types must be distinct. Scanning a single column with
+ * `column<FieldT>()` only touches the bytes of that field, while `operator[]` gives a proxy to a whole row.
+ *
+ * @tparam FieldTs the types of the fields of each record, typically stronk types.
+ */
+template<typename... FieldTs>
+struct stronk_soa
+{
+    static_assert(sizeof...(FieldTs) > 0, "a stronk_soa needs at least one field");
+    static_assert(((stronk_details::count_of<FieldTs, FieldTs...>() == 1) && ...),
+                  "the fields of a stronk_soa are looked up by type, so every field type must be unique");
+
+    template<typename FieldT>
+    using column_t = std::vector<FieldT, aligned_allocator<FieldT>>;
+
+    using value_type = std::tuple<FieldTs...>;
+    using size_type = std::size_t;
+
+  private:
+    // Proxy for a row, assigning a value_type (or another row) assigns all the fields of the row
+    template<typename SoaT>
+    struct basic_row_reference
+    {
+        SoaT* _soa;
+        size_type _index;
+
+        template<typename FieldT>
+        [[nodiscard]]
+        constexpr auto get() const -> auto&
+        {
+            return this->_soa->template column<FieldT>()[this->_index];
+        }
+
+        constexpr explicit(false) operator value_type() const  // NOLINT(google-explicit-constructor)
+        {
+            return value_type {this->template get<FieldTs>()...};
+        }
+
+        constexpr auto operator=(const value_type& values) const -> const basic_row_reference&
+            requires(!std::is_const_v<SoaT>)
+        {
+            ((this->template get<FieldTs>() = std::get<FieldTs>(values)), ...);
+            return *this;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-c-copy-assignment-signature) assigns the referenced values, like a T&
+        constexpr auto operator=(const basic_row_reference& other) const -> const basic_row_reference&
+            requires(!std::is_const_v<SoaT>)
+        {
+            return *this = static_cast<value_type>(other);
+        }
+    };
+
+    template<typename SoaT, typename ReferenceT>
+    struct basic_iterator
+    {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ReferenceT;
+        using difference_type = std::ptrdiff_t;
+        using reference = ReferenceT;
+
+        SoaT* _soa = nullptr;
+        size_type _index = 0;
+
+        constexpr auto operator*() const -> reference
+        {
+            return reference {this->_soa, this->_index};
+        }
+
+        constexpr auto operator++() -> basic_iterator&
+        {
+            this->_index++;
+            return *this;
+        }
+
+        constexpr auto operator++(int) -> basic_iterator
+        {
+            auto copy = *this;
+            this->_index++;
+            return copy;
+        }
+
+        constexpr auto operator==(const basic_iterator& other) const -> bool = default;
+    };
+
+  public:
+    using reference = basic_row_reference<stronk_soa>;
+    using const_reference = basic_row_reference<const stronk_soa>;
+
+    using iterator = basic_iterator<stronk_soa, reference>;
+    using const_iterator = basic_iterator<const stronk_soa, const_reference>;
+
+    constexpr stronk_soa() = default;
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type
+    {
+        return std::get<0>(this->_columns).size();
+    }
+
+    [[nodiscard]]
+    constexpr auto empty() const noexcept -> bool
+    {
+        return this->size() == 0;
+    }
+
+    constexpr void reserve(size_type capacity)
+    {
+        std::apply([capacity](auto&... columns) { (columns.reserve(capacity), ...); }, this->_columns);
+    }
+
+    constexpr void resize(size_type size)
+    {
+        std::apply([size](auto&... columns) { (columns.resize(size), ...); }, this->_columns);
+    }
+
+    constexpr void clear() noexcept
+    {
+        std::apply([](auto&... columns) { (columns.clear(), ...); }, this->_columns);
+    }
+
+    // Appends a row. If appending any of the fields throws, the fields already appended are removed again
+    constexpr void push_back(const FieldTs&... values)
+    {
+        auto pushed = std::size_t {0};
+        try {
+            ((std::get<column_t<FieldTs>>(this->_columns).push_back(values), pushed++), ...);
+        } catch (...) {
+            this->pop_back_columns(pushed);
+            throw;
+        }
+    }
+
+    constexpr void push_back(const value_type& values)
+    {
+        this->push_back(std::get<FieldTs>(values)...);
+    }
+
+    /**
+     * @brief All values of a single field, contiguous and SIMD aligned.
+     */
+    template<typename FieldT>
+    [[nodiscard]]
+    constexpr auto column() noexcept -> std::span<FieldT>
+    {
+        static_assert(stronk_details::count_of<FieldT, FieldTs...>() == 1, "FieldT is not a field of this stronk_soa");
+        return std::get<column_t<FieldT>>(this->_columns);
+    }
+
+    template<typename FieldT>
+    [[nodiscard]]
+    constexpr auto column() const noexcept -> std::span<const FieldT>
+    {
+        static_assert(stronk_details::count_of<FieldT, FieldTs...>() == 1, "FieldT is not a field of this stronk_soa");
+        return std::get<column_t<FieldT>>(this->_columns);
+    }
+
+    [[nodiscard]]
+    constexpr auto operator[](size_type index) noexcept -> reference
+    {
+        return reference {this, index};
+    }
+
+    [[nodiscard]]
+    constexpr auto operator[](size_type index) const noexcept -> const_reference
+    {
+        return const_reference {this, index};
+    }
+
+    [[nodiscard]]
+    constexpr auto at(size_type index) -> reference
+    {
+        if (index >= this->size()) {
+            throw std::out_of_range("stronk_soa index out of range");
+        }
+        return (*this)[index];
+    }
+
+    [[nodiscard]]
+    constexpr auto at(size_type index) const -> const_reference
+    {
+        if (index >= this->size()) {
+            throw std::out_of_range("stronk_soa index out of range");
+        }
+        return (*this)[index];
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() noexcept -> iterator
+    {
+        return iterator {this, 0};
+    }
+
+    [[nodiscard]]
+    constexpr auto end() noexcept -> iterator
+    {
+        return iterator {this, this->size()};
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() const noexcept -> const_iterator
+    {
+        return const_iterator {this, 0};
+    }
+
+    [[nodiscard]]
+    constexpr auto end() const noexcept -> const_iterator
+    {
+        return const_iterator {this, this->size()};
+    }
+
+  private:
+    std::tuple<column_t<FieldTs>...> _columns;
+
+    // Removes the last value of the first count columns
+    constexpr void pop_back_columns(std::size_t count) noexcept
+    {
+        std::apply(
+            [count](auto&... columns)
+            {
+                auto column = std::size_t {0};
+                ((column++ < count ? columns.pop_back() : void()), ...);
+            },
+            this->_columns);
+    }
+};
+
+}  // namespace twig
@@ -0,0 +1,343 @@
+#pragma once
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+
+#include "stronk/unit.hpp"
+#include "stronk/unit_vector.hpp"
+#include "stronk/utilities/macros.hpp"
+
+namespace twig
+{
+
+// Summation policies
+// Sums into multiple independent accumulators, which the compiler can keep in SIMD registers. This is the default.
+struct lane_summation
+{
+};
+
+// Recursively halves the input and sums blocks with lane_summation. Slightly slower, but the rounding error only grows
+// with the logarithm of the size, which matters for long series of floating points.
+struct pairwise_summation
+{
+};
+
+template<typename T>
+concept summation_policy = std::same_as<T, lane_summation> || std::same_as<T, pairwise_summation>;
+
+template<typename T>
+concept reducible_value = unit_value_like<T> || std::is_arithmetic_v<T>;
+
+// Contiguous ranges of unit values (std::vector, std::span, stronk_soa columns, ...) or unit_vectors.
+template<typename RangeT>
+concept unit_value_range =
+    unit_vector_like<RangeT>
+    || (std::ranges::contiguous_range<RangeT> && reducible_value<std::ranges::range_value_t<RangeT>>);
+
+namespace stronk_details
+{
+
+// Number of independent accumulators, enough to fill an AVX-512 register of doubles while hiding the add latency.
+constexpr static auto reduction_lanes = std::size_t {8};
+
+// Below this size pairwise summation stops splitting the input.
+constexpr static auto pairwise_block_size = std::size_t {256};
+
+template<typename RangeT>
+struct unit_value_range_traits
+{
+    using value_type = std::ranges::range_value_t<RangeT>;
+
+    // Returns a function giving the value at an index, only valid while `values` is alive
+    STRONK_FORCEINLINE constexpr static auto element_accessor(const RangeT& values)
+    {
+        return [data = std::ranges::data(values)](std::size_t index) -> const value_type&
+        {
+            return data[index];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        };
+    }
+};
+
+template<unit_vector_like RangeT>
+struct unit_value_range_traits<RangeT>
+{
+    using value_type = typename RangeT::value_type;
+
+    STRONK_FORCEINLINE constexpr static auto element_accessor(const RangeT& values)
+    {
+        return [data = values.template unwrap<RangeT>().data()](std::size_t index) -> value_type
+        {
+            return value_type {data[index]};  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        };
+    }
+};
+
+template<typename RangeT>
+using unit_value_range_value_t = typename unit_value_range_traits<RangeT>::value_type;
+
+template<typename RangeT>
+[[nodiscard]]
+constexpr auto unit_value_range_size(const RangeT& values) -> std::size_t
+{
+    return static_cast<std::size_t>(std::ranges::size(values));
+}
+
+template<typename AccT, std::size_t LanesV>
+[[nodiscard]]
+STRONK_FORCEINLINE constexpr auto combine_lanes(std::array<AccT, LanesV> lanes) -> AccT
+{
+    // combine as a tree, which keeps the same error bound as the lanes themselves
+    for (auto width = LanesV / 2; width > 0; width /= 2) {
+        for (auto j = std::size_t {0}; j < width; ++j) {
+            lanes[j] += lanes[j + width];
+        }
+    }
+    return lanes[0];
+}
+
+// Sums `element_at(i)` for i in [begin, end) into reduction_lanes independent accumulators.
+template<typename AccT, typename ElementFnT>
+[[nodiscard]]
+STRONK_FORCEINLINE constexpr auto lane_sum(std::size_t begin, std::size_t end, const ElementFnT& element_at) -> AccT
+{
+    auto lanes = std::array<AccT, reduction_lanes> {};
+    auto i = begin;
+    for (; i + reduction_lanes <= end; i += reduction_lanes) {
+        STRONK_VECTORIZE_LOOP
+        for (auto j = std::size_t {0}; j < reduction_lanes; ++j) {
+            lanes[j] += element_at(i + j);
+        }
+    }
+    for (auto j = std::size_t {0}; i < end; ++i, ++j) {
+        lanes[j] += element_at(i);
+    }
+    return combine_lanes(lanes);
+}
+
+template<typename AccT, typename ElementFnT>
+[[nodiscard]]
+constexpr auto pairwise_sum(std::size_t begin, std::size_t end, const ElementFnT& element_at) -> AccT
+{
+    if (end - begin <= pairwise_block_size) {
+        return lane_sum<AccT>(begin, end, element_at);
+    }
+    // split on a multiple of the lanes, so only the last block has a tail
+    const auto half = ((end - begin) / 2 + reduction_lanes - 1) / reduction_lanes * reduction_lanes;
+    return pairwise_sum<AccT>(begin, begin + half, element_at) + pairwise_sum<AccT>(begin + half, end, element_at);
+}
+
+template<typename AccT, summation_policy PolicyT, typename ElementFnT>
+[[nodiscard]]
+constexpr auto sum_with_policy(std::size_t size, const ElementFnT& element_at) -> AccT
+{
+    if constexpr (std::same_as<PolicyT, pairwise_summation>) {
+        return pairwise_sum<AccT>(0, size, element_at);
+    } else {
+        return lane_sum<AccT>(0, size, element_at);
+    }
+}
+
+// Finds the smallest (or largest with a flipped comparison) raw value, using independent lanes like lane_sum.
+// NaNs are skipped, unless the first value is a NaN.
+template<typename RawT, typename IsBetterT, typename ElementFnT>
+[[nodiscard]]
+constexpr auto lane_extreme(std::size_t size, const ElementFnT& element_at, const IsBetterT& is_better) -> RawT
+{
+    auto lanes = std::array<RawT, reduction_lanes> {};
+    lanes.fill(unwrap_unit_value(element_at(0)));
+    auto i = std::size_t {0};
+    for (; i + reduction_lanes <= size; i += reduction_lanes) {
+        STRONK_VECTORIZE_LOOP
+        for (auto j = std::size_t {0}; j < reduction_lanes; ++j) {
+            const auto value = unwrap_unit_value(element_at(i + j));
+            lanes[j] = is_better(value, lanes[j]) ? value : lanes[j];
+        }
+    }
+    for (; i < size; ++i) {
+        const auto value = unwrap_unit_value(element_at(i));
+        lanes[0] = is_better(value, lanes[0]) ? value : lanes[0];
+    }
+    auto best = lanes[0];
+    for (const auto& lane : lanes) {
+        best = is_better(lane, best) ? lane : best;
+    }
+    return best;
+}
+
+// Index of the first value equal to the extreme value. Finding the value first keeps both passes branch free.
+template<typename RawT, typename IsBetterT, typename ElementFnT>
+[[nodiscard]]
+constexpr auto lane_arg_extreme(std::size_t size, const ElementFnT& element_at, const IsBetterT& is_better)
+    -> std::size_t
+{
+    const auto best = lane_extreme<RawT>(size, element_at, is_better);
+    for (auto i = std::size_t {0}; i < size; ++i) {
+        if (unwrap_unit_value(element_at(i)) == best) {
+            return i;
+        }
+    }
+    return 0;  // only when every value is a NaN
+}
+
+template<typename RangeT>
+constexpr void throw_if_empty(const RangeT& values, const char* message)
+{
+    if (unit_value_range_size(values) == 0) {
+        throw std::invalid_argument(message);
+    }
+}
+
+struct is_less
+{
+    template<typename T>
+    STRONK_FORCEINLINE constexpr auto operator()(const T& a, const T& b) const -> bool
+    {
+        return a < b;
+    }
+};
+
+struct is_greater
+{
+    template<typename T>
+    STRONK_FORCEINLINE constexpr auto operator()(const T& a, const T& b) const -> bool
+    {
+        return a > b;
+    }
+};
+
+}  // namespace stronk_details
+
+/**
+ * @brief Sum of all values, in the same unit as the values. The sum of no values is zero.
+ */
+template<unit_value_range RangeT, summation_policy PolicyT = lane_summation>
+[[nodiscard]]
+constexpr auto sum(const RangeT& values, PolicyT /*policy*/ = {})
+{
+    using value_t = stronk_details::unit_value_range_value_t<RangeT>;
+    using raw_t = stronk_details::unit_value_underlying_t<value_t>;
+    const auto element_at = stronk_details::unit_value_range_traits<RangeT>::element_accessor(values);
+    return value_t {stronk_details::sum_with_policy<raw_t, PolicyT>(
+        stronk_details::unit_value_range_size(values),
+        [&element_at](std::size_t i) { return stronk_details::unwrap_unit_value(element_at(i)); })};
+}
+
+/**
+ * @brief Arithmetic mean of the values, in the same unit as the values.
+ *
+ * @throws std::invalid_argument if there are no values
+ */
+template<unit_value_range RangeT, summation_policy PolicyT = lane_summation>
+[[nodiscard]]
+constexpr auto mean(const RangeT& values, PolicyT policy = {})
+{
+    stronk_details::throw_if_empty(values, "cannot take the mean of no values");
+    using raw_t = stronk_details::unit_value_underlying_t<stronk_details::unit_value_range_value_t<RangeT>>;
+    return twig::sum(values, policy) / static_cast<raw_t>(stronk_details::unit_value_range_size(values));
+}
+
+/**
+ * @brief The smallest value
+ *
+ * @throws std::invalid_argument if there are no values
+ */
+template<unit_value_range RangeT>
+[[nodiscard]]
+constexpr auto min(const RangeT& values)
+{
+    stronk_details::throw_if_empty(values, "cannot take the min of no values");
+    using value_t = stronk_details::unit_value_range_value_t<RangeT>;
+    using raw_t = stronk_details::unit_value_underlying_t<value_t>;
+    return value_t {stronk_details::lane_extreme<raw_t>(
+        stronk_details::unit_value_range_size(values),
+        stronk_details::unit_value_range_traits<RangeT>::element_accessor(values),
+        stronk_details::is_less {})};
+}
+
+/**
+ * @brief The largest value
+ *
+ * @throws std::invalid_argument if there are no values
+ */
+template<unit_value_range RangeT>
+[[nodiscard]]
+constexpr auto max(const RangeT& values)
+{
+    stronk_details::throw_if_empty(values, "cannot take the max of no values");
+    using value_t = stronk_details::unit_value_range_value_t<RangeT>;
+    using raw_t = stronk_details::unit_value_underlying_t<value_t>;
+    return value_t {stronk_details::lane_extreme<raw_t>(
+        stronk_details::unit_value_range_size(values),
+        stronk_details::unit_value_range_traits<RangeT>::element_accessor(values),
+        stronk_details::is_greater {})};
+}
+
+/**
+ * @brief Index of the first occurrence of the smallest value
+ *
+ * @throws std::invalid_argument if there are no values
+ */
+template<unit_value_range RangeT>
+[[nodiscard]]
+constexpr auto argmin(const RangeT& values) -> std::size_t
+{
+    stronk_details::throw_if_empty(values, "cannot take the argmin of no values");
+    using raw_t = stronk_details::unit_value_underlying_t<stronk_details::unit_value_range_value_t<RangeT>>;
+    return stronk_details::lane_arg_extreme<raw_t>(
+        stronk_details::unit_value_range_size(values),
+        stronk_details::unit_value_range_traits<RangeT>::element_accessor(values),
+        stronk_details::is_less {});
+}
+
+/**
+ * @brief Index of the first occurrence of the largest value
+ *
+ * @throws std::invalid_argument if there are no values
+ */
+template<unit_value_range RangeT>
+[[nodiscard]]
+constexpr auto argmax(const RangeT& values) -> std::size_t
+{
+    stronk_details::throw_if_empty(values, "cannot take the argmax of no values");
+    using raw_t = stronk_details::unit_value_underlying_t<stronk_details::unit_value_range_value_t<RangeT>>;
+    return stronk_details::lane_arg_extreme<raw_t>(
+        stronk_details::unit_value_range_size(values),
+        stronk_details::unit_value_range_traits<RangeT>::element_accessor(values),
+        stronk_details::is_greater {});
+}
+
+/**
+ * @brief Sum of the element-wise products, in the multiplied unit of the two ranges.
+ *
+ * `dot(prices, volumes)` of euro/MWh and MWh values gives euros. Each product goes through the regular unit operator*,
+ * so specializations of `underlying_multiply_operation` are respected.
+ *
+ * @throws std::invalid_argument if the ranges have different sizes
+ */
+template<unit_value_range LhsT, unit_value_range RhsT, summation_policy PolicyT = lane_summation>
+    requires(std::is_invocable_v<stronk_details::multiplies_op,
+                                 stronk_details::unit_value_range_value_t<LhsT>,
+                                 stronk_details::unit_value_range_value_t<RhsT>>)
+[[nodiscard]]
+constexpr auto dot(const LhsT& lhs, const RhsT& rhs, PolicyT /*policy*/ = {})
+{
+    const auto size = stronk_details::unit_value_range_size(lhs);
+    if (size != stronk_details::unit_value_range_size(rhs)) {
+        throw std::invalid_argument("dot operands must have the same size");
+    }
+    using product_t = std::invoke_result_t<stronk_details::multiplies_op,
+                                           stronk_details::unit_value_range_value_t<LhsT>,
+                                           stronk_details::unit_value_range_value_t<RhsT>>;
+    using raw_t = stronk_details::unit_value_underlying_t<product_t>;
+    const auto lhs_at = stronk_details::unit_value_range_traits<LhsT>::element_accessor(lhs);
+    const auto rhs_at = stronk_details::unit_value_range_traits<RhsT>::element_accessor(rhs);
+    return product_t {stronk_details::sum_with_policy<raw_t, PolicyT>(
+        size,
+        [&lhs_at, &rhs_at](std::size_t i)
+        { return stronk_details::unwrap_unit_value(stronk_details::multiplies_op {}(lhs_at(i), rhs_at(i))); })};
+}
+
+}  // namespace twig
@@ -1,9 +1,17 @@
 #pragma once
+#include <bit>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
 #include <type_traits>
 
+#include "stronk/skills/can_view.hpp"
 #include "stronk/stronk.hpp"
+#include "stronk/utilities/crc32c.hpp"
+#include "stronk/utilities/macros.hpp"
 
 namespace twig
 {
@@ -14,6 +22,183 @@ struct [[deprecated("std::hash<T> now just works for all stronk types which can
     using can_hash_indicator = std::true_type;
 };
 
+namespace stronk_details
+{
+
+// The finalizer of MurmurHash3: a bijection of 64 bit integers where every input bit affects every output bit
+STRONK_FORCEINLINE constexpr auto mix64(std::uint64_t value) noexcept -> std::uint64_t
+{
+    value ^= value >> 33U;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33U;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    value ^= value >> 33U;
+    return value;
+}
+
+template<typename T>
+concept hashable_as_bits =
+    (std::is_arithmetic_v<T> || std::is_enum_v<T>) && sizeof(T) <= sizeof(std::uint64_t) && !std::is_same_v<T, bool>;
+
+// The bits of the value as an integer, with equal values (i.e. -0.0 and 0.0) giving equal bits
+template<hashable_as_bits T>
+STRONK_FORCEINLINE constexpr auto hash_bits(const T& value) noexcept -> std::uint64_t
+{
+    if constexpr (std::is_floating_point_v<T>) {
+        using bits_t = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+        return value == T {0} ? 0 : static_cast<std::uint64_t>(std::bit_cast<bits_t>(value));
+    } else if constexpr (std::is_enum_v<T>) {
+        return static_cast<std::uint64_t>(static_cast<std::underlying_type_t<T>>(value));
+    } else {
+        return static_cast<std::uint64_t>(value);
+    }
+}
+
+template<typename T>
+STRONK_FORCEINLINE constexpr auto unwrap_for_hash(const T& value) noexcept -> const underlying_or_self_t<T>&
+{
+    if constexpr (stronk_like<T>) {
+        return value.template unwrap<T>();
+    } else {
+        return value;
+    }
+}
+
+}  // namespace stronk_details
+
+// Hashes with std::hash, which is the identity function for integers in the common standard libraries. Fine for
+// std::map like lookups of random keys, but sequential ids fill only some of the buckets of an unordered_map.
+struct identity_hash_policy
+{
+    template<typename T>
+    [[nodiscard]]
+    STRONK_FORCEINLINE auto operator()(const T& value) const noexcept -> std::size_t
+    {
+        return std::hash<T> {}(value);
+    }
+};
+
+// Mixes all bits of numbers into all bits of the hash with a multiply-xorshift finalizer, which compilers can
+// vectorize. Other types are mixed after std::hash.
+struct mix_hash_policy
+{
+    template<typename T>
+    [[nodiscard]]
+    STRONK_FORCEINLINE constexpr auto operator()(const T& value) const noexcept -> std::size_t
+    {
+        if constexpr (stronk_details::hashable_as_bits<T>) {
+            return static_cast<std::size_t>(stronk_details::mix64(stronk_details::hash_bits(value)));
+        } else {
+            return static_cast<std::size_t>(stronk_details::mix64(std::hash<T> {}(value)));
+        }
+    }
+};
+
+// Hashes with the CRC32C instruction of the cpu (a software table when unavailable), spread over all bits of the hash.
+// Strings are hashed by their characters.
+struct crc32c_hash_policy
+{
+    template<typename T>
+    [[nodiscard]]
+    STRONK_FORCEINLINE auto operator()(const T& value) const noexcept -> std::size_t
+    {
+        auto crc = std::uint32_t {0};
+        if constexpr (stronk_details::hashable_as_bits<T>) {
+            const auto bits = stronk_details::hash_bits(value);
+            crc = stronk_details::crc32c(std::as_bytes(std::span {&bits, 1}));
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            const auto text = std::string_view {value};
+            crc = stronk_details::crc32c(std::as_bytes(std::span {text.data(), text.size()}));
+        } else {
+            const auto hash = std::hash<T> {}(value);
+            crc = stronk_details::crc32c(std::as_bytes(std::span {&hash, 1}));
+        }
+        // the golden ratio multiplier carries the 32 bits of the crc into the high bits of the hash too
+        return static_cast<std::size_t>(static_cast<std::uint64_t>(crc) * 0x9E3779B97F4A7C15ULL);
+    }
+};
+
+/**
+ * @brief Selects the hash policy std::hash uses for the stronk type, e.g.
+ * `stronk<id, int64_t, can_equate, can_hash_with<mix_hash_policy>::skill>`. Without it std::hash of the underlying
+ * type is used.
+ */
+template<typename HashPolicyT>
+struct can_hash_with
+{
+    template<typename StronkT>
+    struct skill
+    {
+        using stronk_hash_policy = HashPolicyT;
+    };
+};
+
+namespace stronk_details
+{
+
+template<typename T>
+struct hash_policy_of
+{
+    using type = identity_hash_policy;
+};
+
+template<typename T>
+    requires requires { typename T::stronk_hash_policy; }
+struct hash_policy_of<T>
+{
+    using type = typename T::stronk_hash_policy;
+};
+
+// The given hash policy, or when void the policy std::hash<T> uses
+template<typename HashPolicyT, typename T>
+using hash_policy_or_default_t =
+    std::conditional_t<std::is_void_v<HashPolicyT>, typename hash_policy_of<T>::type, HashPolicyT>;
+
+}  // namespace stronk_details
+
+/**
+ * @brief Hash many keys at once into hashes, e.g. to precompute the buckets of a batch of lookups. The loop over
+ * mix_hash_policy is vectorized, while crc32c_hash_policy keeps the cpu busy with independent crc instructions.
+ *
+ * @tparam HashPolicyT the policy to hash with. By default the keys are hashed like `std::hash<T>` does, so the hashes
+ * can be used to look up the keys in hash containers.
+ * @throws std::invalid_argument if hashes is not of the same size as keys
+ */
+template<typename HashPolicyT = void, typename T>
+void hash_span(std::span<const T> keys, std::span<std::size_t> hashes)
+{
+    if (keys.size() != hashes.size()) {
+        throw std::invalid_argument("hash_span needs a hash for each key");
+    }
+    const auto policy = stronk_details::hash_policy_or_default_t<HashPolicyT, T> {};
+    const auto* in = keys.data();
+    auto* out = hashes.data();
+    const auto size = keys.size();
+    STRONK_VECTORIZE_LOOP
+    for (auto i = std::size_t {0}; i < size; ++i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        out[i] = policy(stronk_details::unwrap_for_hash(in[i]));
+    }
+}
+
+/**
+ * @brief A hash of several values, e.g. the stronk fields of a composite key. Each value is hashed with the policy, or
+ * by default like `std::hash` of its own type does, and the hashes are mixed in order, so swapping two values gives
+ * another hash.
+ */
+template<typename HashPolicyT = void, typename... Ts>
+[[nodiscard]]
+constexpr auto combined_hash(const Ts&... values) noexcept -> std::size_t
+{
+    auto hash = std::uint64_t {0};
+    ((hash = stronk_details::mix64(
+          hash + 0x9E3779B97F4A7C15ULL
+          + static_cast<std::uint64_t>(stronk_details::hash_policy_or_default_t<HashPolicyT, Ts> {}(
+              stronk_details::unwrap_for_hash(values))))),
+     ...);
+    return static_cast<std::size_t>(hash);
+}
+
 }  // namespace twig
 
 template<twig::stronk_like T>
@@ -22,6 +207,24 @@ struct std::hash<T>  // NOLINT(cert-dcl58-cpp) std::hash is exempt from this rul
     [[nodiscard]]
     auto operator()(const T& s) const noexcept -> std::size_t
     {
-        return std::hash<typename T::underlying_type> {}(s.template unwrap<T>());
+        using policy_t = typename twig::stronk_details::hash_policy_of<T>::type;
+        return policy_t {}(s.template unwrap<T>());
+    }
+};
+
+// Stronk strings hash like their views, which makes the hash transparent: hash containers can look up by view_t or
+// std::string_view without constructing a key, when also using the transparent std::equal_to of can_view.hpp
+template<twig::stronk_details::string_viewable_stronk T>
+struct std::hash<T>  // NOLINT(cert-dcl58-cpp) std::hash is exempt from this rule
+{
+    using is_transparent = void;
+    using policy_t = typename twig::stronk_details::hash_policy_of<T>::type;
+
+    template<twig::stronk_details::string_key_of<T> KeyT>
+    [[nodiscard]]
+    auto operator()(const KeyT& key) const noexcept -> std::size_t
+    {
+        // std::hash<std::string_view> is required to equal std::hash<std::string> for the same chars
+        return policy_t {}(twig::stronk_details::as_string_view<T>(key));
     }
 };
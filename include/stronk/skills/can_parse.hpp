@@ -0,0 +1,76 @@
+#pragma once
+#include <charconv>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include "stronk/stronk.hpp"
+
+namespace twig
+{
+
+namespace stronk_details
+{
+
+// Parses the whole text with std::from_chars, returning std::errc::invalid_argument if there are trailing characters
+template<typename T>
+auto from_chars_exact(std::string_view text, T& value) noexcept -> std::errc
+{
+    const auto* end = text.data() + text.size();  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    auto result = std::from_chars_result {};
+    if constexpr (std::is_floating_point_v<T>) {
+        result = std::from_chars(text.data(), end, value, std::chars_format::general);
+    } else {
+        result = std::from_chars(text.data(), end, value);
+    }
+    if (result.ec == std::errc {} && result.ptr != end) {
+        return std::errc::invalid_argument;
+    }
+    return result.ec;
+}
+
+}  // namespace stronk_details
+
+// Arithmetic types, and stronk types wrapping them, which can be parsed with std::from_chars
+template<typename T>
+concept parsable = std::is_arithmetic_v<stronk_details::underlying_or_self_t<T>>
+    && !std::is_same_v<stronk_details::underlying_or_self_t<T>, bool>;
+
+/**
+ * @brief Parse the text as a T with std::from_chars, so independent of the locale and without allocating.
+ *
+ * The whole text must be a number in the format of std::from_chars: no leading whitespace or `+`, and for floating
+ * points no hex prefix.
+ *
+ * @throws std::invalid_argument if the text is not a number
+ * @throws std::out_of_range if the number does not fit in the underlying type
+ */
+template<parsable T>
+[[nodiscard]]
+auto parse(std::string_view text) -> T
+{
+    auto value = stronk_details::underlying_or_self_t<T> {};
+    const auto error = stronk_details::from_chars_exact(text, value);
+    if (error == std::errc::result_out_of_range) {
+        throw std::out_of_range("'" + std::string(text) + "' is out of range for the type");
+    }
+    if (error != std::errc {}) {
+        throw std::invalid_argument("'" + std::string(text) + "' is not a number");
+    }
+    return T {value};
+}
+
+template<typename StronkT>
+struct can_parse
+{
+    // @see twig::parse
+    [[nodiscard]]
+    static auto parse(std::string_view text) -> StronkT
+    {
+        return twig::parse<StronkT>(text);
+    }
+};
+
+}  // namespace twig
@@ -1,4 +1,9 @@
 #pragma once
+#include <concepts>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 #include "stronk/stronk.hpp"
 namespace twig
@@ -94,4 +99,53 @@ struct can_be_mutable_viewed_as
     };
 };
 
+namespace stronk_details
+{
+
+// Stronk strings viewable as string_views, e.g. stronk_string. Their views hash and compare like the strings, so hash
+// containers keyed by them can look up by view_t or std::string_view without constructing a key
+template<typename T>
+concept string_viewable_stronk = stronk_like<T> && requires { typename T::view_t; }
+    && std::same_as<typename T::underlying_type, std::string>
+    && std::same_as<typename T::view_t::underlying_type, std::string_view>;
+
+template<string_viewable_stronk T, typename KeyT>
+constexpr auto as_string_view(const KeyT& key) noexcept -> std::string_view
+{
+    if constexpr (std::same_as<KeyT, T>) {
+        return key.template unwrap<T>();
+    } else if constexpr (std::same_as<KeyT, typename T::view_t>) {
+        return key.template unwrap<typename T::view_t>();
+    } else {
+        return std::string_view {key};
+    }
+}
+
+// Keys which can be looked up in hash containers keyed by the stronk string T
+template<typename KeyT, typename T>
+concept string_key_of = std::same_as<KeyT, T> || std::same_as<KeyT, typename T::view_t>
+    || std::convertible_to<const KeyT&, std::string_view>;
+
+}  // namespace stronk_details
+
 }  // namespace twig
+
+/**
+ * @brief A transparent std::equal_to for stronk strings which can equate, so e.g.
+ * `std::unordered_map<stronk_string_t, V>::find` takes a view_t or std::string_view (together with the transparent
+ * std::hash from can_hash.hpp). Stronk strings without can_equate keep the primary std::equal_to, which does not
+ * compile as they have no operator==.
+ */
+template<twig::stronk_details::string_viewable_stronk T>
+    requires std::is_base_of_v<twig::can_equate<T>, T>
+struct std::equal_to<T>  // NOLINT(cert-dcl58-cpp) std::equal_to may be specialized for program-defined types
+{
+    using is_transparent = void;
+
+    template<twig::stronk_details::string_key_of<T> LhsT, twig::stronk_details::string_key_of<T> RhsT>
+    [[nodiscard]]
+    constexpr auto operator()(const LhsT& lhs, const RhsT& rhs) const noexcept -> bool
+    {
+        return twig::stronk_details::as_string_view<T>(lhs) == twig::stronk_details::as_string_view<T>(rhs);
+    }
+};
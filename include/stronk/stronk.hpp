@@ -7,6 +7,7 @@
 
 #include "stronk/utilities/equality.hpp"
 #include "stronk/utilities/macros.hpp"
+#include "stronk/utilities/simd.hpp"
 
 namespace twig
 {
@@ -157,6 +158,27 @@ concept stronk_like = requires(T v) {
     { v.template unwrap<T>() } -> std::convertible_to<typename T::underlying_type>;
 };
 
+namespace stronk_details
+{
+
+// The underlying type of stronk types, and the type itself for other types
+template<typename T>
+struct underlying_or_self
+{
+    using type = T;
+};
+
+template<stronk_like T>
+struct underlying_or_self<T>
+{
+    using type = typename T::underlying_type;
+};
+
+template<typename T>
+using underlying_or_self_t = typename underlying_or_self<T>::type;
+
+}  // namespace stronk_details
+
 template<typename StronkT>
 struct can_negate
 {
@@ -321,10 +343,14 @@ struct default_can_equate_builder<T>
 template<typename StronkT>
 struct can_equate_underlying_type_specific
 {
-    STRONK_FORCEINLINE constexpr friend auto operator==(const StronkT& lhs, const StronkT& rhs) -> bool
+    // returns a mask rather than a bool for simd underlying types
+    STRONK_FORCEINLINE constexpr friend auto operator==(const StronkT& lhs, const StronkT& rhs)
     {
-        if constexpr (std::is_floating_point_v<typename StronkT::underlying_type>) {
+        using underlying_t = typename StronkT::underlying_type;
+        if constexpr (std::is_floating_point_v<underlying_t>) {
             return twig::stronk_details::almost_equals<is_close_using_abs_tol_only_params>(lhs, rhs);
+        } else if constexpr (simd_like<underlying_t> && std::is_floating_point_v<simd_scalar_t<underlying_t>>) {
+            return twig::stronk_details::almost_equals_lanes<is_close_using_abs_tol_only_params>(lhs, rhs);
         } else {
             return lhs.template unwrap<StronkT>() == rhs.template unwrap<StronkT>();
         }
@@ -341,6 +367,31 @@ struct can_order
     {
         return lhs.template unwrap<StronkT>() <=> rhs.template unwrap<StronkT>();
     }
+
+    // simd types are not three way comparable, but compare lane-wise into masks
+    STRONK_FORCEINLINE constexpr friend auto operator<(const StronkT& lhs, const StronkT& rhs)
+        requires(simd_like<typename StronkT::underlying_type>)
+    {
+        return lhs.template unwrap<StronkT>() < rhs.template unwrap<StronkT>();
+    }
+
+    STRONK_FORCEINLINE constexpr friend auto operator>(const StronkT& lhs, const StronkT& rhs)
+        requires(simd_like<typename StronkT::underlying_type>)
+    {
+        return lhs.template unwrap<StronkT>() > rhs.template unwrap<StronkT>();
+    }
+
+    STRONK_FORCEINLINE constexpr friend auto operator<=(const StronkT& lhs, const StronkT& rhs)
+        requires(simd_like<typename StronkT::underlying_type>)
+    {
+        return lhs.template unwrap<StronkT>() <= rhs.template unwrap<StronkT>();
+    }
+
+    STRONK_FORCEINLINE constexpr friend auto operator>=(const StronkT& lhs, const StronkT& rhs)
+        requires(simd_like<typename StronkT::underlying_type>)
+    {
+        return lhs.template unwrap<StronkT>() >= rhs.template unwrap<StronkT>();
+    }
 };
 
 template<typename StronkT>
@@ -5,6 +5,7 @@
 
 #include <stronk/utilities/dimensions.hpp>
 #include <stronk/utilities/macros.hpp>
+#include <stronk/utilities/scale_conversion.hpp>
 
 #include "stronk/stronk.hpp"
 #include "stronk/utilities/ratio.hpp"  // IWYU pragma: export
@@ -22,6 +23,11 @@ concept unit_like = requires {
 template<typename T>
 concept unit_value_like = stronk_like<T> && requires { typename T::unit_t; };
 
+// Containers of unit values (see stronk/unit_vector.hpp) define their own element-wise operators, and mark themselves
+// with this indicator so the scalar overloads below are not considered for them.
+template<typename T>
+concept unit_value_container_like = requires { typename T::unit_value_container_indicator; };
+
 template<typename T, typename ValueT>
 concept is_unit = std::same_as<typename T::unit_t::dimensions_t, typename ValueT::dimensions_t>;
 
@@ -41,7 +47,10 @@ concept canonical_scale_like =
 template<typename Tag, canonical_scale_like ScaleT, template<typename StronkT> typename... SkillTs>
 struct unit
 {
-    using dimensions_t = std::conditional_t<dimensions_like<Tag>, Tag, twig::create_dimensions_t<dimension<Tag, 1>>>;
+    // only creates the dimensions of Tag when it is not dimensions itself
+    using dimensions_t = typename std::conditional_t<dimensions_like<Tag>,
+                                                     std::type_identity<Tag>,
+                                                     details::canonical_dimensions<dimension<Tag, 1>>>::type;
     using scale_t = ScaleT;
 
     unit() = delete;  // Do not construct this type
@@ -100,10 +109,9 @@ struct unit
         template<scale_like NewScaleT>
         constexpr auto to() const
         {
-            using converter = twig::ratio_divide<ScaleT, NewScaleT>;
+            using converter = stronk_details::scale_converter<ScaleT, NewScaleT, UnderlyingT>;
             using result_value_t = scaled_t<NewScaleT>::template value<UnderlyingT>;
-            return result_value_t {
-                this->val() * static_cast<UnderlyingT>(converter::num) / static_cast<UnderlyingT>(converter::den)};
+            return result_value_t {converter::apply(this->val())};
         }
     };
 };
@@ -209,21 +217,21 @@ STRONK_FORCEINLINE constexpr auto operator*(const A& a, const B& b)
 }
 
 template<typename T, unit_value_like B>
-    requires(!unit_value_like<T>)
+    requires(!unit_value_like<T> && !unit_value_container_like<T>)
 STRONK_FORCEINLINE constexpr auto operator*(const T& a, const B& b) -> B
 {
     return B {a * b.template unwrap<B>()};
 }
 
 template<unit_value_like A, typename T>
-    requires(!unit_value_like<T>)
+    requires(!unit_value_like<T> && !unit_value_container_like<T>)
 STRONK_FORCEINLINE constexpr auto operator*(const A& a, const T& b) -> A
 {
     return A {a.template unwrap<A>() * b};
 }
 
 template<unit_value_like A, typename T>
-    requires(!unit_value_like<T>)
+    requires(!unit_value_like<T> && !unit_value_container_like<T>)
 STRONK_FORCEINLINE constexpr auto operator*=(A& a, const T& b) -> A&
 {
     a.template unwrap<A>() *= b;
@@ -269,7 +277,7 @@ STRONK_FORCEINLINE constexpr auto operator/(const A& a, const B& b)
 }
 
 template<typename T, unit_value_like B>
-    requires(!unit_value_like<T>)
+    requires(!unit_value_like<T> && !unit_value_container_like<T>)
 STRONK_FORCEINLINE constexpr auto operator/(const T& a, const B& b)
 {
     auto res = a / b.template unwrap<B>();
@@ -281,20 +289,79 @@ STRONK_FORCEINLINE constexpr auto operator/(const T& a, const B& b)
 }
 
 template<unit_value_like A, typename T>
-    requires(!unit_value_like<T>)
+    requires(!unit_value_like<T> && !unit_value_container_like<T>)
 STRONK_FORCEINLINE constexpr auto operator/(const A& a, const T& b) -> A
 {
     return A {a.template unwrap<A>() / b};
 }
 
 template<unit_value_like A, typename T>
-    requires(!unit_value_like<T>)
+    requires(!unit_value_like<T> && !unit_value_container_like<T>)
 STRONK_FORCEINLINE constexpr auto operator/=(A& a, const T& b) -> A&
 {
     a.template unwrap<A>() /= b;
     return a;
 }
 
+// ==================
+// Mixed scales
+// ==================
+
+// Values of the same unit and underlying type, but with different scales
+template<typename A, typename B>
+concept unit_values_of_different_scales = unit_value_like<A> && unit_value_like<B> && !std::same_as<A, B>
+    && std::same_as<typename A::underlying_type, typename B::underlying_type>
+    && std::same_as<typename A::unit_t::template scaled_t<typename B::unit_t::scale_t>, typename B::unit_t>;
+
+template<unit_value_like A, unit_value_like B>
+using common_scale_t = twig::ratio_common<typename A::unit_t::scale_t, typename B::unit_t::scale_t>;
+
+/**
+ * @brief The type values of different scales are converted to before they are added, subtracted or compared.
+ *
+ * Like the common type of std::chrono::durations, the scale is the largest one which both scales are integer multiples
+ * of, so converting to it is exact for integers. When one scale is a multiple of the other, only one of the operands is
+ * converted.
+ */
+template<unit_value_like A, unit_value_like B>
+using common_scale_value_t = unit_scaled_value_t<common_scale_t<A, B>, typename A::unit_t, typename A::underlying_type>;
+
+template<typename A, typename B>
+    requires(unit_values_of_different_scales<A, B>
+             && requires(const common_scale_value_t<A, B>& common) { common + common; })
+STRONK_FORCEINLINE constexpr auto operator+(const A& a, const B& b) -> common_scale_value_t<A, B>
+{
+    using common_scale = common_scale_t<A, B>;
+    return a.template to<common_scale>() + b.template to<common_scale>();
+}
+
+template<typename A, typename B>
+    requires(unit_values_of_different_scales<A, B>
+             && requires(const common_scale_value_t<A, B>& common) { common - common; })
+STRONK_FORCEINLINE constexpr auto operator-(const A& a, const B& b) -> common_scale_value_t<A, B>
+{
+    using common_scale = common_scale_t<A, B>;
+    return a.template to<common_scale>() - b.template to<common_scale>();
+}
+
+template<typename A, typename B>
+    requires(unit_values_of_different_scales<A, B>
+             && requires(const common_scale_value_t<A, B>& common) { common == common; })
+STRONK_FORCEINLINE constexpr auto operator==(const A& a, const B& b)
+{
+    using common_scale = common_scale_t<A, B>;
+    return a.template to<common_scale>() == b.template to<common_scale>();
+}
+
+template<typename A, typename B>
+    requires(unit_values_of_different_scales<A, B>
+             && requires(const common_scale_value_t<A, B>& common) { common <=> common; })
+STRONK_FORCEINLINE constexpr auto operator<=>(const A& a, const B& b)
+{
+    using common_scale = common_scale_t<A, B>;
+    return a.template to<common_scale>() <=> b.template to<common_scale>();
+}
+
 template<unit_like UnitT, typename UnderlyingT>
 constexpr auto make(UnderlyingT&& value)
 {
@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "stronk/unit.hpp"
+#include "stronk/utilities/macros.hpp"
+#include "stronk/utilities/scale_conversion.hpp"
+
+namespace twig
+{
+
+// The type `FromValueT::to<ToUnitT>()` results in
+template<unit_like ToUnitT, unit_value_like FromValueT>
+using converted_value_t = decltype(std::declval<const FromValueT&>().template to<ToUnitT>());
+
+/**
+ * @brief Convert a whole range of unit values to another scale, writing the results into `out`.
+ *
+ * The conversion ratio is folded at compile time, so floating points cost a single multiply per value, and integers
+ * are converted exactly without any hardware divide. The loop is vectorizable. Floating point factors which are not
+ * exact, e.g. `1 / 1000`, are folded too, so results can be 1 ULP off from `to<ToUnitT>()` (see
+ * `bulk_scale_folding_policy`).
+ *
+ * @tparam ToUnitT a unit with the same dimensions as the values, but with a different scale
+ * @throws std::invalid_argument if `in` and `out` have different sizes
+ * @throws std::overflow_error if an integer value does not fit in the new scale. The values of `out` are unspecified.
+ */
+template<unit_like ToUnitT, std::ranges::contiguous_range InRangeT, std::ranges::contiguous_range OutRangeT>
+    requires(unit_value_like<std::ranges::range_value_t<InRangeT>>
+             && std::same_as<typename ToUnitT::dimensions_t,
+                             typename std::ranges::range_value_t<InRangeT>::unit_t::dimensions_t>
+             && std::same_as<std::ranges::range_value_t<OutRangeT>,
+                             converted_value_t<ToUnitT, std::ranges::range_value_t<InRangeT>>>)
+constexpr void convert(const InRangeT& in, OutRangeT&& out)
+{
+    using from_t = std::ranges::range_value_t<InRangeT>;
+    using to_t = std::ranges::range_value_t<OutRangeT>;
+    using converter = stronk_details::scale_converter<typename from_t::unit_t::scale_t,
+                                                      typename to_t::unit_t::scale_t,
+                                                      typename from_t::underlying_type,
+                                                      stronk_details::bulk_scale_folding_policy>;
+
+    const auto size = static_cast<std::size_t>(std::ranges::size(in));
+    if (size != static_cast<std::size_t>(std::ranges::size(out))) {
+        throw std::invalid_argument("convert requires the input and output to have the same size");
+    }
+
+    const auto* in_data = std::ranges::data(in);
+    auto* out_data = std::ranges::data(out);
+    auto overflowed = false;
+    STRONK_VECTORIZE_LOOP
+    for (auto i = std::size_t {0}; i < size; ++i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        out_data[i].template unwrap<to_t>() = converter::apply(in_data[i].template unwrap<from_t>(), overflowed);
+    }
+    if (overflowed) {
+        throw std::overflow_error("a value does not fit in its underlying type after the scale conversion");
+    }
+}
+
+/**
+ * @brief Convert a whole range of unit values to another scale.
+ *
+ * @return a std::vector of the converted values
+ */
+template<unit_like ToUnitT, std::ranges::contiguous_range InRangeT>
+    requires(unit_value_like<std::ranges::range_value_t<InRangeT>>)
+[[nodiscard]]
+constexpr auto convert(const InRangeT& in)
+{
+    auto out = std::vector<converted_value_t<ToUnitT, std::ranges::range_value_t<InRangeT>>>(std::ranges::size(in));
+    twig::convert<ToUnitT>(in, out);
+    return out;
+}
+
+}  // namespace twig
@@ -0,0 +1,229 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "stronk/unit.hpp"
+#include "stronk/utilities/dimensions.hpp"
+#include "stronk/utilities/ratio.hpp"
+#include "stronk/utilities/strings.hpp"
+
+namespace twig
+{
+
+// A unit tag registering its symbol, e.g. `constexpr static std::string_view symbol = "Wh";`. Tags can opt out of SI
+// prefixes with `constexpr static bool si_prefixable = false;`, e.g. for currencies.
+template<typename T>
+concept has_symbol = requires { std::string_view {T::symbol}; };
+
+/**
+ * @brief The symbol of a unit, e.g. `MWh` or `EUR/MWh`, as a constexpr `value` convertible to std::string_view.
+ *
+ * It is derived from the symbols registered by the units of the dimensions of UnitT and an SI prefix for the scale,
+ * when all of them have a symbol. Specialize it to give a specific unit another symbol, e.g. `h` for seconds scaled by
+ * 3600.
+ */
+template<typename UnitT>
+struct unit_symbol
+{
+};
+
+template<typename UnitT>
+concept has_unit_symbol = requires { std::string_view {unit_symbol<UnitT>::value}; };
+
+template<has_unit_symbol UnitT>
+constexpr auto unit_symbol_v = std::string_view {unit_symbol<UnitT>::value};
+
+template<typename T>
+concept unit_value_with_symbol_like = unit_value_like<T> && has_unit_symbol<typename T::unit_t>;
+
+namespace stronk_details
+{
+
+struct si_prefix
+{
+    int exponent;  // of 10
+    std::string_view symbol;
+};
+
+constexpr auto si_prefixes = std::array {
+    si_prefix {18, "E"},
+    si_prefix {15, "P"},
+    si_prefix {12, "T"},
+    si_prefix {9, "G"},
+    si_prefix {6, "M"},
+    si_prefix {3, "k"},
+    si_prefix {2, "h"},
+    si_prefix {1, "da"},
+    si_prefix {-1, "d"},
+    si_prefix {-2, "c"},
+    si_prefix {-3, "m"},
+    si_prefix {-6, "\xC2\xB5"},  // µ in UTF-8
+    si_prefix {-9, "n"},
+    si_prefix {-12, "p"},
+    si_prefix {-15, "f"},
+    si_prefix {-18, "a"},
+};
+
+// The exponent of the power of 10, if value is one
+constexpr auto power_of_ten_exponent(u_biggest_int_t value) noexcept -> int
+{
+    auto exponent = 0;
+    while (value % 10 == 0) {
+        value /= 10;
+        exponent++;
+    }
+    return value == 1 ? exponent : -1;
+}
+
+constexpr auto find_si_prefix(int exponent) noexcept -> const si_prefix*
+{
+    for (const auto& prefix : si_prefixes) {
+        if (prefix.exponent == exponent) {
+            return &prefix;
+        }
+    }
+    return nullptr;
+}
+
+struct symbol_entry
+{
+    std::string_view symbol;
+    int rank;
+    bool prefixable;
+    std::string_view prefix;
+};
+
+template<typename DimT>
+constexpr auto symbol_entry_of() noexcept -> symbol_entry
+{
+    using unit_t = typename DimT::unit_t;
+    auto prefixable = true;
+    if constexpr (requires { unit_t::si_prefixable; }) {
+        prefixable = unit_t::si_prefixable;
+    }
+    return symbol_entry {std::string_view {unit_t::symbol}, DimT::rank, prefixable, {}};
+}
+
+template<std::size_t CapacityV>
+constexpr void append_symbol_entries(str::string_builder<CapacityV>& builder,
+                                     const auto& entries,
+                                     bool positive,
+                                     std::string_view separator)
+{
+    auto first = true;
+    for (const auto& entry : entries) {
+        if ((entry.rank > 0) != positive) {
+            continue;
+        }
+        if (!first) {
+            builder.append(separator);
+        }
+        first = false;
+        builder.append(entry.prefix);
+        builder.append(entry.symbol);
+        if (entry.rank > 1 || entry.rank < -1) {
+            builder.append("^");
+            builder.append_integer(entry.rank > 0 ? entry.rank : -entry.rank);
+        }
+    }
+}
+
+// Builds the symbol of the dimensions and scale: the units with positive ranks, then `/` and the units with negative
+// ranks, with the SI prefix of the scale on the first unit it fits, or the scale in brackets if it fits none.
+template<std::size_t CapacityV, dimension_like... DimTs>
+constexpr auto build_unit_symbol(u_biggest_int_t num, u_biggest_int_t den) -> str::string_builder<CapacityV>
+{
+    auto entries = std::array<symbol_entry, sizeof...(DimTs)> {symbol_entry_of<DimTs>()...};
+    // sort by symbol, so the order does not depend on the compiler specific order of the dimensions
+    for (auto i = std::size_t {1}; i < entries.size(); i++) {
+        for (auto j = i; j > 0 && entries[j].symbol < entries[j - 1].symbol; j--) {
+            std::swap(entries[j], entries[j - 1]);
+        }
+    }
+
+    const auto num_exponent = power_of_ten_exponent(num);
+    const auto den_exponent = power_of_ten_exponent(den);
+    auto prefixed = num == 1 && den == 1;
+    if (num_exponent >= 0 && den_exponent >= 0 && !prefixed) {
+        const auto exponent = num_exponent - den_exponent;
+        for (auto positive : {true, false}) {
+            for (auto& entry : entries) {
+                if (prefixed || !entry.prefixable || (entry.rank > 0) != positive || exponent % entry.rank != 0) {
+                    continue;
+                }
+                if (const auto* prefix = find_si_prefix(exponent / entry.rank); prefix != nullptr) {
+                    entry.prefix = prefix->symbol;
+                    prefixed = true;
+                }
+            }
+        }
+    }
+
+    auto builder = str::string_builder<CapacityV> {};
+    if (!prefixed) {
+        builder.append("[");
+        builder.append_integer(num);
+        if (den != 1) {
+            builder.append("/");
+            builder.append_integer(den);
+        }
+        builder.append("]");
+    }
+
+    auto negatives = std::size_t {0};
+    auto positives = std::size_t {0};
+    for (const auto& entry : entries) {
+        (entry.rank > 0 ? positives : negatives)++;
+    }
+    if (positives == 0) {
+        builder.append("1");
+    }
+    append_symbol_entries(builder, entries, true, "*");
+    if (negatives != 0) {
+        builder.append(negatives > 1 ? "/(" : "/");
+        append_symbol_entries(builder, entries, false, "*");
+        builder.append(negatives > 1 ? ")" : "");
+    }
+    return builder;
+}
+
+template<typename DimensionsT, typename ScaleT>
+struct derived_unit_symbol;
+
+template<dimension_like... DimTs, typename ScaleT>
+struct derived_unit_symbol<details::dimensions<DimTs...>, ScaleT>
+{
+    // every unit adds at most a prefix, a separator and a rank, plus the scale in brackets and the parentheses
+    constexpr static auto capacity =
+        (std::size_t {96} + ... + (std::string_view {DimTs::unit_t::symbol}.size() + std::size_t {16}));
+    constexpr static auto builder = build_unit_symbol<capacity, DimTs...>(ScaleT::num, ScaleT::den);
+    constexpr static auto value = str::to_string_literal<builder.size>(builder);
+};
+
+template<typename DimensionsT>
+struct all_dimensions_have_symbols : std::false_type
+{
+};
+
+template<dimension_like... DimTs>
+    requires(sizeof...(DimTs) > 0)
+struct all_dimensions_have_symbols<details::dimensions<DimTs...>>
+    : std::bool_constant<(has_symbol<typename DimTs::unit_t> && ...)>
+{
+};
+
+}  // namespace stronk_details
+
+template<unit_like UnitT>
+    requires(stronk_details::all_dimensions_have_symbols<typename UnitT::dimensions_t>::value)
+struct unit_symbol<UnitT>
+{
+    constexpr static auto value =
+        stronk_details::derived_unit_symbol<typename UnitT::dimensions_t, typename UnitT::scale_t>::value;
+};
+
+}  // namespace twig
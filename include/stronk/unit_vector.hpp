@@ -0,0 +1,702 @@
+#pragma once
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "stronk/stronk.hpp"
+#include "stronk/unit.hpp"
+#include "stronk/utilities/aligned_allocator.hpp"
+#include "stronk/utilities/macros.hpp"
+
+namespace twig
+{
+
+namespace stronk_details
+{
+
+// Identity units are represented by their raw underlying type, so the underlying type of those is the type itself.
+template<typename ValueT>
+struct unit_value_underlying
+{
+    using type = ValueT;
+    using unit_t = identity_unit;
+};
+
+template<unit_value_like ValueT>
+struct unit_value_underlying<ValueT>
+{
+    using type = typename ValueT::underlying_type;
+    using unit_t = typename ValueT::unit_t;
+};
+
+template<typename ValueT>
+using unit_value_underlying_t = typename unit_value_underlying<ValueT>::type;
+
+template<typename ValueT>
+[[nodiscard]]
+STRONK_FORCEINLINE constexpr auto unwrap_unit_value(const ValueT& value) noexcept
+    -> const unit_value_underlying_t<ValueT>&
+{
+    if constexpr (unit_value_like<ValueT>) {
+        return value.template unwrap<ValueT>();
+    } else {
+        return value;
+    }
+}
+
+// Writes `element_at(i)` for every index of `out`. Callers pass force-inlined lambdas working on raw underlying
+// values, so the loop body is plain arithmetic the compiler is told it can vectorize without alias analysis.
+template<typename OutT, typename ElementFnT>
+STRONK_FORCEINLINE constexpr void generate_into(std::span<OutT> out, const ElementFnT& element_at)
+{
+    const auto size = out.size();
+    STRONK_VECTORIZE_LOOP
+    for (auto i = std::size_t {0}; i < size; ++i) {
+        out[i] = element_at(i);
+    }
+}
+
+}  // namespace stronk_details
+
+template<typename ValueT>
+struct basic_unit_vector;
+
+template<typename T>
+struct is_unit_vector : std::false_type
+{
+};
+
+template<typename ValueT>
+struct is_unit_vector<basic_unit_vector<ValueT>> : std::true_type
+{
+};
+
+template<typename T>
+concept unit_vector_like = is_unit_vector<std::remove_cvref_t<T>>::value;
+
+// Either a unit_vector or a lazy element-wise expression over unit_vectors.
+template<typename T>
+concept unit_vector_expression_like = unit_value_container_like<std::remove_cvref_t<T>>;
+
+namespace stronk_details
+{
+
+struct plus_op
+{
+    template<typename A, typename B>
+    STRONK_FORCEINLINE constexpr auto operator()(const A& a, const B& b) const -> decltype(a + b)
+    {
+        return a + b;
+    }
+};
+
+struct minus_op
+{
+    template<typename A, typename B>
+    STRONK_FORCEINLINE constexpr auto operator()(const A& a, const B& b) const -> decltype(a - b)
+    {
+        return a - b;
+    }
+};
+
+struct multiplies_op
+{
+    template<typename A, typename B>
+    STRONK_FORCEINLINE constexpr auto operator()(const A& a, const B& b) const -> decltype(a * b)
+    {
+        return a * b;
+    }
+};
+
+struct divides_op
+{
+    template<typename A, typename B>
+    STRONK_FORCEINLINE constexpr auto operator()(const A& a, const B& b) const -> decltype(a / b)
+    {
+        return a / b;
+    }
+};
+
+// Leaf referring to the values of a vector which outlives the expression.
+template<typename ValueT>
+struct unit_vector_view_expression
+{
+    using value_type = ValueT;
+
+    const unit_value_underlying_t<ValueT>* _data;
+    std::size_t _size;
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> std::size_t
+    {
+        return this->_size;
+    }
+
+    [[nodiscard]]
+    STRONK_FORCEINLINE constexpr auto eval(std::size_t index) const noexcept -> value_type
+    {
+        return value_type {this->_data[index]};  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+};
+
+// Leaf taking ownership of a vector which was passed as a temporary, so the expression cannot dangle.
+template<typename ValueT>
+struct unit_vector_owning_expression
+{
+    using value_type = ValueT;
+
+    basic_unit_vector<ValueT> _vector;
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> std::size_t
+    {
+        return this->_vector.size();
+    }
+
+    [[nodiscard]]
+    STRONK_FORCEINLINE constexpr auto eval(std::size_t index) const noexcept -> value_type
+    {
+        return this->_vector[index];
+    }
+};
+
+// Leaf repeating a single value for every element.
+template<typename T>
+struct broadcast_expression
+{
+    using value_type = T;
+
+    T _value;
+
+    [[nodiscard]]
+    STRONK_FORCEINLINE constexpr auto eval(std::size_t /*index*/) const noexcept -> const value_type&
+    {
+        return this->_value;
+    }
+};
+
+template<typename T>
+struct is_broadcast_expression : std::false_type
+{
+};
+
+template<typename T>
+struct is_broadcast_expression<broadcast_expression<T>> : std::true_type
+{
+};
+
+// Turns an operand of an element-wise operator into an expression node.
+template<typename T>
+[[nodiscard]]
+constexpr auto make_unit_vector_operand(T&& operand)
+{
+    using operand_t = std::remove_cvref_t<T>;
+    if constexpr (unit_vector_like<operand_t> && std::is_lvalue_reference_v<T>) {
+        const auto values = std::as_const(operand).template unwrap<operand_t>();
+        return unit_vector_view_expression<typename operand_t::value_type> {values.data(), values.size()};
+    } else if constexpr (unit_vector_like<operand_t>) {
+        return unit_vector_owning_expression<typename operand_t::value_type> {std::forward<T>(operand)};
+    } else if constexpr (unit_vector_expression_like<operand_t>) {
+        return operand_t {std::forward<T>(operand)};
+    } else {
+        return broadcast_expression<operand_t> {std::forward<T>(operand)};
+    }
+}
+
+template<typename T>
+using unit_vector_operand_t = decltype(make_unit_vector_operand(std::declval<T>()));
+
+template<typename T>
+using unit_vector_element_t = typename unit_vector_operand_t<T>::value_type;
+
+template<typename OpT, typename LhsT, typename RhsT>
+concept unit_vector_element_op = std::invocable<const OpT&, const LhsT&, const RhsT&>;
+
+}  // namespace stronk_details
+
+/**
+ * @brief A lazy element-wise operation between two expression nodes, evaluated when assigned to a unit_vector.
+ *
+ * `value_type` is the type of applying the operator to the element types of the operands, so the resulting
+ * dimensions and scale are fully decided at compile time.
+ */
+template<typename OpT, typename LhsT, typename RhsT>
+struct unit_vector_binary_expression
+{
+    using value_type = std::remove_cvref_t<decltype(std::declval<const OpT&>()(
+        std::declval<const typename LhsT::value_type&>(), std::declval<const typename RhsT::value_type&>()))>;
+    using unit_value_container_indicator = std::true_type;
+
+    LhsT _lhs;
+    RhsT _rhs;
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> std::size_t
+    {
+        if constexpr (stronk_details::is_broadcast_expression<LhsT>::value) {
+            return this->_rhs.size();
+        } else {
+            return this->_lhs.size();
+        }
+    }
+
+    [[nodiscard]]
+    STRONK_FORCEINLINE constexpr auto eval(std::size_t index) const -> value_type
+    {
+        return OpT {}(this->_lhs.eval(index), this->_rhs.eval(index));
+    }
+
+    [[nodiscard]]
+    constexpr auto operator[](std::size_t index) const -> value_type
+    {
+        return this->eval(index);
+    }
+};
+
+namespace stronk_details
+{
+
+template<typename OpT, typename LhsT, typename RhsT>
+using unit_vector_expression_t =
+    unit_vector_binary_expression<OpT, unit_vector_operand_t<LhsT>, unit_vector_operand_t<RhsT>>;
+
+template<typename OpT, typename LhsT, typename RhsT>
+[[nodiscard]]
+constexpr auto make_unit_vector_expression(LhsT&& lhs, RhsT&& rhs) -> unit_vector_expression_t<OpT, LhsT, RhsT>
+{
+    auto lhs_operand = make_unit_vector_operand(std::forward<LhsT>(lhs));
+    auto rhs_operand = make_unit_vector_operand(std::forward<RhsT>(rhs));
+    if constexpr (!is_broadcast_expression<decltype(lhs_operand)>::value
+                  && !is_broadcast_expression<decltype(rhs_operand)>::value)
+    {
+        if (lhs_operand.size() != rhs_operand.size()) {
+            throw std::invalid_argument("unit_vector operands must have the same size");
+        }
+    }
+    return {std::move(lhs_operand), std::move(rhs_operand)};
+}
+
+template<typename OpT, typename LhsT, typename RhsT>
+concept unit_vector_operands = (unit_vector_expression_like<LhsT> || unit_vector_expression_like<RhsT>)
+                               && unit_vector_element_op<OpT, unit_vector_element_t<LhsT>, unit_vector_element_t<RhsT>>;
+
+}  // namespace stronk_details
+
+/**
+ * @brief A contiguous container of unit values, storing the raw underlying values in SIMD aligned memory.
+ *
+ * Elements are exposed as `ValueT` (by value). Arithmetic on whole vectors is lazy: `price * volume + fee` builds an
+ * expression whose element type, and therefore dimensions and scale, is derived from the regular unit operators at
+ * compile time. Assigning the expression to a vector evaluates the whole tree in one fused, vectorizable loop over the
+ * raw values, without allocating any intermediate vectors. Note that expressions refer to the vectors they were built
+ * from (unless these were temporaries), so they should be evaluated before those are modified or destroyed.
+ *
+ * Use the `unit_vector<UnitT, T>` alias rather than naming this type directly.
+ */
+template<typename ValueT>
+struct basic_unit_vector
+{
+    using value_type = ValueT;
+    using underlying_type = stronk_details::unit_value_underlying_t<ValueT>;
+    using unit_t = typename stronk_details::unit_value_underlying<ValueT>::unit_t;
+    using allocator_type = aligned_allocator<underlying_type>;
+    using size_type = std::size_t;
+    using unit_value_container_indicator = std::true_type;
+
+    // Proxy returned from mutable indexing, reads and writes the raw value through the unit value type.
+    struct reference
+    {
+        underlying_type* _ptr;
+
+        // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+        STRONK_FORCEINLINE constexpr explicit(false) operator value_type() const noexcept
+        {
+            return value_type {*this->_ptr};
+        }
+
+        STRONK_FORCEINLINE constexpr auto operator=(const value_type& value) const noexcept -> const reference&
+        {
+            *this->_ptr = stronk_details::unwrap_unit_value(value);
+            return *this;
+        }
+
+        // Assigns the referenced value - we never want to rebind the proxy.
+        // NOLINTNEXTLINE(cppcoreguidelines-c-copy-assignment-signature, misc-unconventional-assign-operator)
+        STRONK_FORCEINLINE constexpr auto operator=(const reference& other) const noexcept -> const reference&
+        {
+            *this->_ptr = *other._ptr;
+            return *this;
+        }
+    };
+
+    struct const_iterator
+    {
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using value_type = ValueT;
+        using difference_type = std::ptrdiff_t;
+        using reference = ValueT;
+
+        const underlying_type* _ptr = nullptr;
+
+        [[nodiscard]]
+        constexpr auto operator*() const noexcept -> value_type
+        {
+            return value_type {*this->_ptr};
+        }
+
+        [[nodiscard]]
+        constexpr auto operator[](difference_type offset) const noexcept -> value_type
+        {
+            return value_type {this->_ptr[offset]};  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        }
+
+        constexpr auto operator++() noexcept -> const_iterator&
+        {
+            ++this->_ptr;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return *this;
+        }
+
+        constexpr auto operator++(int) noexcept -> const_iterator
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        constexpr auto operator--() noexcept -> const_iterator&
+        {
+            --this->_ptr;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return *this;
+        }
+
+        constexpr auto operator--(int) noexcept -> const_iterator
+        {
+            auto copy = *this;
+            --*this;
+            return copy;
+        }
+
+        constexpr auto operator+=(difference_type offset) noexcept -> const_iterator&
+        {
+            this->_ptr += offset;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return *this;
+        }
+
+        constexpr auto operator-=(difference_type offset) noexcept -> const_iterator&
+        {
+            this->_ptr -= offset;  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            return *this;
+        }
+
+        [[nodiscard]]
+        constexpr friend auto operator+(const_iterator it, difference_type offset) noexcept -> const_iterator
+        {
+            return it += offset;
+        }
+
+        [[nodiscard]]
+        constexpr friend auto operator+(difference_type offset, const_iterator it) noexcept -> const_iterator
+        {
+            return it += offset;
+        }
+
+        [[nodiscard]]
+        constexpr friend auto operator-(const_iterator it, difference_type offset) noexcept -> const_iterator
+        {
+            return it -= offset;
+        }
+
+        [[nodiscard]]
+        constexpr friend auto operator-(const const_iterator& lhs, const const_iterator& rhs) noexcept
+            -> difference_type
+        {
+            return lhs._ptr - rhs._ptr;
+        }
+
+        constexpr auto operator==(const const_iterator& other) const noexcept -> bool = default;
+        constexpr auto operator<=>(const const_iterator& other) const noexcept -> std::strong_ordering = default;
+    };
+
+    constexpr basic_unit_vector() = default;
+
+    constexpr explicit basic_unit_vector(size_type size)
+        : _data(size, underlying_type {})
+    {
+    }
+
+    constexpr basic_unit_vector(size_type size, const value_type& value)
+        : _data(size, stronk_details::unwrap_unit_value(value))
+    {
+    }
+
+    constexpr basic_unit_vector(std::initializer_list<value_type> values)
+        : basic_unit_vector(std::span<const value_type> {values.begin(), values.size()})
+    {
+    }
+
+    constexpr explicit basic_unit_vector(std::span<const value_type> values)
+    {
+        this->_data.reserve(values.size());
+        for (const auto& value : values) {
+            this->_data.push_back(stronk_details::unwrap_unit_value(value));
+        }
+    }
+
+    // Evaluates the expression in a single pass
+    template<unit_vector_expression_like ExpressionT>
+        requires(!unit_vector_like<ExpressionT>
+                 && std::same_as<typename std::remove_cvref_t<ExpressionT>::value_type, value_type>)
+    constexpr explicit(false) basic_unit_vector(const ExpressionT& expression)  // NOLINT(google-explicit-constructor)
+    {
+        this->assign(expression);
+    }
+
+    template<unit_vector_expression_like ExpressionT>
+        requires(!unit_vector_like<ExpressionT>
+                 && std::same_as<typename std::remove_cvref_t<ExpressionT>::value_type, value_type>)
+    constexpr auto operator=(const ExpressionT& expression) -> basic_unit_vector&
+    {
+        this->assign(expression);
+        return *this;
+    }
+
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type
+    {
+        return this->_data.size();
+    }
+
+    [[nodiscard]]
+    constexpr auto empty() const noexcept -> bool
+    {
+        return this->_data.empty();
+    }
+
+    [[nodiscard]]
+    constexpr auto capacity() const noexcept -> size_type
+    {
+        return this->_data.capacity();
+    }
+
+    constexpr void reserve(size_type capacity)
+    {
+        this->_data.reserve(capacity);
+    }
+
+    constexpr void resize(size_type size)
+    {
+        this->_data.resize(size, underlying_type {});
+    }
+
+    constexpr void clear() noexcept
+    {
+        this->_data.clear();
+    }
+
+    constexpr void push_back(const value_type& value)
+    {
+        this->_data.push_back(stronk_details::unwrap_unit_value(value));
+    }
+
+    [[nodiscard]]
+    STRONK_FORCEINLINE constexpr auto operator[](size_type index) const noexcept -> value_type
+    {
+        return value_type {this->_data[index]};
+    }
+
+    [[nodiscard]]
+    STRONK_FORCEINLINE constexpr auto operator[](size_type index) noexcept -> reference
+    {
+        return reference {&this->_data[index]};
+    }
+
+    [[nodiscard]]
+    constexpr auto at(size_type index) const -> value_type
+    {
+        return value_type {this->_data.at(index)};
+    }
+
+    [[nodiscard]]
+    constexpr auto begin() const noexcept -> const_iterator
+    {
+        return const_iterator {this->_data.data()};
+    }
+
+    [[nodiscard]]
+    constexpr auto end() const noexcept -> const_iterator
+    {
+        return this->begin() + static_cast<std::ptrdiff_t>(this->size());
+    }
+
+    // Access to the raw values, for handing over to kernels which are not unit aware. As with `stronk::unwrap` you need
+    // to name the vector type you expect, to be protected if the unit of the vector changes.
+    template<typename ExpectedT>
+    [[nodiscard]]
+    constexpr auto unwrap() noexcept -> std::span<underlying_type>
+    {
+        static_assert(std::same_as<ExpectedT, basic_unit_vector>,
+                      "To access the underlying values you need to provide the unit_vector type you expect to be "
+                      "querying. By doing so you will be protected from unsafe accesses if you chose to change the "
+                      "type");
+        return std::span<underlying_type> {this->_data};
+    }
+
+    template<typename ExpectedT>
+    [[nodiscard]]
+    constexpr auto unwrap() const noexcept -> std::span<const underlying_type>
+    {
+        static_assert(std::same_as<ExpectedT, basic_unit_vector>,
+                      "To access the underlying values you need to provide the unit_vector type you expect to be "
+                      "querying. By doing so you will be protected from unsafe accesses if you chose to change the "
+                      "type");
+        return std::span<const underlying_type> {this->_data};
+    }
+
+    // The container of the raw values, for serialization extensions to read into without an intermediate copy. As with
+    // `unwrap` you need to name the vector type you expect.
+    template<typename ExpectedT>
+    [[nodiscard]]
+    constexpr auto unwrap_storage() noexcept -> std::vector<underlying_type, allocator_type>&
+    {
+        static_assert(std::same_as<ExpectedT, basic_unit_vector>,
+                      "To access the underlying values you need to provide the unit_vector type you expect to be "
+                      "querying. By doing so you will be protected from unsafe accesses if you chose to change the "
+                      "type");
+        return this->_data;
+    }
+
+    template<typename ExpectedT>
+    [[nodiscard]]
+    constexpr auto unwrap_storage() const noexcept -> const std::vector<underlying_type, allocator_type>&
+    {
+        static_assert(std::same_as<ExpectedT, basic_unit_vector>,
+                      "To access the underlying values you need to provide the unit_vector type you expect to be "
+                      "querying. By doing so you will be protected from unsafe accesses if you chose to change the "
+                      "type");
+        return this->_data;
+    }
+
+    template<typename OtherT>
+        requires(std::same_as<typename stronk_details::unit_vector_expression_t<stronk_details::plus_op,
+                                                                                 const basic_unit_vector&,
+                                                                                 OtherT>::value_type,
+                              value_type>)
+    constexpr auto operator+=(OtherT&& other) -> basic_unit_vector&
+    {
+        this->assign(stronk_details::make_unit_vector_expression<stronk_details::plus_op>(
+            std::as_const(*this), std::forward<OtherT>(other)));
+        return *this;
+    }
+
+    template<typename OtherT>
+        requires(std::same_as<typename stronk_details::unit_vector_expression_t<stronk_details::minus_op,
+                                                                                 const basic_unit_vector&,
+                                                                                 OtherT>::value_type,
+                              value_type>)
+    constexpr auto operator-=(OtherT&& other) -> basic_unit_vector&
+    {
+        this->assign(stronk_details::make_unit_vector_expression<stronk_details::minus_op>(
+            std::as_const(*this), std::forward<OtherT>(other)));
+        return *this;
+    }
+
+    template<typename ScalarT>
+        requires(!unit_vector_expression_like<ScalarT>
+                 && std::same_as<decltype(std::declval<ValueT>() * std::declval<ScalarT>()), value_type>)
+    constexpr auto operator*=(const ScalarT& scalar) -> basic_unit_vector&
+    {
+        this->assign(stronk_details::make_unit_vector_expression<stronk_details::multiplies_op>(std::as_const(*this),
+                                                                                                 scalar));
+        return *this;
+    }
+
+    template<typename ScalarT>
+        requires(!unit_vector_expression_like<ScalarT>
+                 && std::same_as<decltype(std::declval<ValueT>() / std::declval<ScalarT>()), value_type>)
+    constexpr auto operator/=(const ScalarT& scalar) -> basic_unit_vector&
+    {
+        this->assign(stronk_details::make_unit_vector_expression<stronk_details::divides_op>(std::as_const(*this),
+                                                                                               scalar));
+        return *this;
+    }
+
+  private:
+    // Every element only depends on the same index of its operands, so the expression may refer to this vector.
+    template<typename ExpressionT>
+    constexpr void assign(const ExpressionT& expression)
+    {
+        const auto size = expression.size();
+        if (size != this->_data.size()) {
+            // resizing directly to the target size, the values are about to be overwritten anyway
+            this->_data = std::vector<underlying_type, allocator_type>(size, underlying_type {});
+        }
+        stronk_details::generate_into(std::span<underlying_type> {this->_data},
+                                      [&expression](std::size_t i)
+                                      { return stronk_details::unwrap_unit_value(expression.eval(i)); });
+    }
+
+    std::vector<underlying_type, allocator_type> _data;
+};
+
+template<unit_like UnitT, typename UnderlyingT>
+using unit_vector = basic_unit_vector<unit_value_t<UnitT, UnderlyingT>>;
+
+// ==================
+// Element-wise operators
+// ==================
+
+template<typename LhsT, typename RhsT>
+    requires(stronk_details::unit_vector_operands<stronk_details::plus_op, LhsT, RhsT>)
+[[nodiscard]]
+constexpr auto operator+(LhsT&& lhs, RhsT&& rhs)
+{
+    return stronk_details::make_unit_vector_expression<stronk_details::plus_op>(std::forward<LhsT>(lhs),
+                                                                          std::forward<RhsT>(rhs));
+}
+
+template<typename LhsT, typename RhsT>
+    requires(stronk_details::unit_vector_operands<stronk_details::minus_op, LhsT, RhsT>)
+[[nodiscard]]
+constexpr auto operator-(LhsT&& lhs, RhsT&& rhs)
+{
+    return stronk_details::make_unit_vector_expression<stronk_details::minus_op>(std::forward<LhsT>(lhs),
+                                                                          std::forward<RhsT>(rhs));
+}
+
+template<typename LhsT, typename RhsT>
+    requires(stronk_details::unit_vector_operands<stronk_details::multiplies_op, LhsT, RhsT>)
+[[nodiscard]]
+constexpr auto operator*(LhsT&& lhs, RhsT&& rhs)
+{
+    return stronk_details::make_unit_vector_expression<stronk_details::multiplies_op>(std::forward<LhsT>(lhs),
+                                                                          std::forward<RhsT>(rhs));
+}
+
+template<typename LhsT, typename RhsT>
+    requires(stronk_details::unit_vector_operands<stronk_details::divides_op, LhsT, RhsT>)
+[[nodiscard]]
+constexpr auto operator/(LhsT&& lhs, RhsT&& rhs)
+{
+    return stronk_details::make_unit_vector_expression<stronk_details::divides_op>(std::forward<LhsT>(lhs),
+                                                                          std::forward<RhsT>(rhs));
+}
+
+/**
+ * @brief Evaluates an element-wise expression into a new unit_vector, in a single pass.
+ */
+template<unit_vector_expression_like ExpressionT>
+[[nodiscard]]
+constexpr auto evaluate(const ExpressionT& expression)
+{
+    return basic_unit_vector<typename std::remove_cvref_t<ExpressionT>::value_type>(expression);
+}
+
+}  // namespace twig
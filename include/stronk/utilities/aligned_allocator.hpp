@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace twig
+{
+
+namespace stronk_details
+{
+// Large enough for a full AVX-512 register and a cache line, so bulk kernels never straddle a line on their first load.
+constexpr static auto simd_alignment = std::size_t {64};
+}  // namespace stronk_details
+
+/**
+ * @brief Allocator handing out over-aligned storage, used by the bulk containers to keep their raw buffers SIMD
+ * friendly.
+ */
+template<typename T, std::size_t AlignmentV = stronk_details::simd_alignment>
+struct aligned_allocator
+{
+    static_assert(AlignmentV >= alignof(T), "alignment cannot be weaker than the alignment of the type");
+    static_assert((AlignmentV & (AlignmentV - 1)) == 0, "alignment must be a power of two");
+
+    using value_type = T;
+    constexpr static auto alignment = AlignmentV;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = aligned_allocator<U, AlignmentV>;
+    };
+
+    constexpr aligned_allocator() noexcept = default;
+
+    template<typename U>
+    constexpr explicit(false) aligned_allocator(const aligned_allocator<U, AlignmentV>& /*other*/) noexcept  // NOLINT
+    {
+    }
+
+    [[nodiscard]]
+    auto allocate(std::size_t size) -> T*
+    {
+        if (size > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(::operator new(size * sizeof(T), std::align_val_t {AlignmentV}));
+    }
+
+    void deallocate(T* ptr, [[maybe_unused]] std::size_t size) noexcept
+    {
+        ::operator delete(ptr, std::align_val_t {AlignmentV});
+    }
+
+    template<typename U>
+    constexpr auto operator==(const aligned_allocator<U, AlignmentV>& /*other*/) const noexcept -> bool
+    {
+        return true;
+    }
+};
+
+}  // namespace twig
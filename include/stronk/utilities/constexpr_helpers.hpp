@@ -1,4 +1,6 @@
 #pragma once
+#include <initializer_list>
+#include <string_view>
 #include <type_traits>
 
 namespace twig::stronk_details
@@ -9,6 +11,46 @@ struct not_implemented_type : std::false_type
 {
 };
 
+/**
+ * @brief A compile time string which is unique for the type T, used to give types a consistent order.
+ *
+ * It is the signature of this function as spelled by the compiler, so it is only comparable to keys generated by the
+ * same compiler, and is not meant to be displayed.
+ */
+template<typename T>
+constexpr auto type_key() noexcept -> std::string_view
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return std::string_view {__FUNCSIG__};
+#else
+    return std::string_view {__PRETTY_FUNCTION__};
+#endif
+}
+
+/**
+ * @brief The name of the type T as spelled by the compiler, e.g. `twig::meters`.
+ *
+ * Unlike type_key, the names of non-template class types are the same across compilers, as the `struct ` and `class `
+ * prefixes MSVC adds are removed.
+ */
+template<typename T>
+constexpr auto type_name() noexcept -> std::string_view
+{
+    // the key of a known type tells where the type is in the key
+    constexpr auto probe_key = type_key<double>();
+    constexpr auto prefix_size = probe_key.find("double");
+    constexpr auto suffix_size = probe_key.size() - prefix_size - std::string_view {"double"}.size();
+
+    auto name = type_key<T>();
+    name = name.substr(prefix_size, name.size() - prefix_size - suffix_size);
+    for (auto elaborated : {std::string_view {"struct "}, std::string_view {"class "}, std::string_view {"enum "}}) {
+        if (name.starts_with(elaborated)) {
+            return name.substr(elaborated.size());
+        }
+    }
+    return name;
+}
+
 namespace variadic
 {
 
@@ -0,0 +1,122 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#    include <nmmintrin.h>
+#    define STRONK_CRC32C_X86 1
+#elif defined(__ARM_FEATURE_CRC32)
+#    include <arm_acle.h>
+#endif
+
+namespace twig::stronk_details
+{
+
+// CRC32C (Castagnoli) lookup table for the reflected polynomial, used when no crc instructions are available
+constexpr auto crc32c_table = []()
+{
+    constexpr auto polynomial = std::uint32_t {0x82F63B78U};
+    auto table = std::array<std::uint32_t, 256> {};
+    for (auto i = std::uint32_t {0}; i < table.size(); i++) {
+        auto crc = i;
+        for (auto bit = 0; bit < 8; bit++) {
+            crc = (crc & 1U) != 0 ? (crc >> 1U) ^ polynomial : crc >> 1U;
+        }
+        table[i] = crc;
+    }
+    return table;
+}();
+
+constexpr auto crc32c_software(std::span<const std::byte> bytes, std::uint32_t crc) noexcept -> std::uint32_t
+{
+    for (auto byte : bytes) {
+        crc = crc32c_table[(crc ^ static_cast<std::uint32_t>(byte)) & 0xFFU] ^ (crc >> 8U);
+    }
+    return crc;
+}
+
+#if defined(STRONK_CRC32C_X86)
+
+#    if defined(__SSE4_2__) || defined(__AVX__)
+#        define STRONK_CRC32C_TARGET
+#    elif defined(__GNUC__)
+// compiled for the sse4.2 target, and only called after checking the cpu supports it
+#        define STRONK_CRC32C_TARGET __attribute__((target("sse4.2")))
+#        define STRONK_CRC32C_RUNTIME_DISPATCH 1
+#    endif
+
+#    if defined(STRONK_CRC32C_TARGET)
+STRONK_CRC32C_TARGET inline auto crc32c_hardware(std::span<const std::byte> bytes, std::uint32_t crc) noexcept
+    -> std::uint32_t
+{
+    const auto* data = bytes.data();
+    auto size = bytes.size();
+    auto crc64 = static_cast<std::uint64_t>(crc);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (; size >= sizeof(std::uint64_t); size -= sizeof(std::uint64_t), data += sizeof(std::uint64_t)) {
+        auto word = std::uint64_t {0};
+        std::memcpy(&word, data, sizeof(word));
+        crc64 = _mm_crc32_u64(crc64, word);
+    }
+    crc = static_cast<std::uint32_t>(crc64);
+    for (; size > 0; size--, data++) {  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        crc = _mm_crc32_u8(crc, static_cast<std::uint8_t>(*data));
+    }
+    return crc;
+}
+#    endif
+
+#elif defined(__ARM_FEATURE_CRC32)
+#    define STRONK_CRC32C_TARGET
+
+inline auto crc32c_hardware(std::span<const std::byte> bytes, std::uint32_t crc) noexcept -> std::uint32_t
+{
+    const auto* data = bytes.data();
+    auto size = bytes.size();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (; size >= sizeof(std::uint64_t); size -= sizeof(std::uint64_t), data += sizeof(std::uint64_t)) {
+        auto word = std::uint64_t {0};
+        std::memcpy(&word, data, sizeof(word));
+        crc = __crc32cd(crc, word);
+    }
+    for (; size > 0; size--, data++) {  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        crc = __crc32cb(crc, static_cast<std::uint8_t>(*data));
+    }
+    return crc;
+}
+#endif
+
+// Whether crc32c uses the crc instructions of the cpu
+inline auto crc32c_is_hardware_accelerated() noexcept -> bool
+{
+#if defined(STRONK_CRC32C_RUNTIME_DISPATCH)
+    static const auto supported = __builtin_cpu_supports("sse4.2") != 0;
+    return supported;
+#elif defined(STRONK_CRC32C_TARGET)
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief The CRC32C (Castagnoli) checksum of the bytes, using the crc instructions of the cpu when available.
+ *
+ * @param crc the checksum of the preceding bytes, to checksum data in multiple parts
+ */
+constexpr auto crc32c(std::span<const std::byte> bytes, std::uint32_t crc = 0) noexcept -> std::uint32_t
+{
+    crc = ~crc;
+#if defined(STRONK_CRC32C_TARGET)
+    if (!std::is_constant_evaluated() && crc32c_is_hardware_accelerated()) {
+        return ~crc32c_hardware(bytes, crc);
+    }
+#endif
+    return ~crc32c_software(bytes, crc);
+}
+
+}  // namespace twig::stronk_details
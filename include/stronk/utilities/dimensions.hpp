@@ -1,10 +1,13 @@
 #pragma once
+#include <array>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
-#include <boost/type_index/ctti_type_index.hpp>
 #include <stronk/utilities/constexpr_helpers.hpp>
 
 namespace twig
@@ -51,68 +54,111 @@ struct dimensions;
 
 using empty_dimensions = dimensions<>;
 
-template<dimension_like... As>
-struct dimensions_merge;
-
-// Empty Case implementation
-template<>
-struct dimensions_merge<>
+struct canonical_dimension_entry
 {
-    template<typename AccumulatedDimensionListT, typename... Bs>
-    [[nodiscard]]
-    constexpr static auto merge()
-    {
-        using res_t = typename AccumulatedDimensionListT::template concat_t<Bs...>;
-        return res_t();
-    }
+    std::size_t index = 0;  // index of the dimension in the unsorted list
+    int rank = 0;           // sum of the ranks of all dimensions with that unit
+};
 
-    template<typename... OtherTs>
-    using merge_t = decltype(merge<empty_dimensions, OtherTs...>());
+template<std::size_t SizeV>
+struct canonical_dimension_entries
+{
+    std::array<canonical_dimension_entry, SizeV> values {};
+    std::size_t size = 0;
 };
 
-template<dimension_like A, dimension_like... As>
-struct dimensions_merge<A, As...>
+// The index of the first of Ts which is the same type as T, identifying T among Ts
+template<typename T, typename... Ts>
+constexpr auto first_index_of_type() -> std::size_t
 {
-    template<typename AccumulatedDimensionListT>
-    [[nodiscard]]
-    constexpr static auto merge()
-    {
-        using res_t = typename AccumulatedDimensionListT::template concat_t<A, As...>;
-        return res_t();
+    constexpr auto matches = std::array<bool, sizeof...(Ts)> {std::is_same_v<T, Ts>...};
+    auto index = std::size_t {0};
+    while (!matches[index]) {
+        index++;
     }
+    return index;
+}
 
-    template<typename AccumulatedDimensionListT, dimension_like B, dimension_like... Bs>
-    [[nodiscard]]
-    constexpr static auto merge()
-    {
-        static_assert(A::rank != 0, "Cannot merge dimensions with rank 0");
-        static_assert(B::rank != 0, "Cannot merge dimensions with rank 0");
-
-        using boost::typeindex::ctti_type_index;
-        constexpr auto a_equals_b = std::is_same_v<typename A::unit_t, typename B::unit_t>;
-        constexpr auto a_before_b =
-            ctti_type_index::type_id<typename A::unit_t>().before(ctti_type_index::type_id<typename B::unit_t>());
-
-        if constexpr (a_equals_b) {
-            using new_dim = typename A::template multiply_t<B>;
-            if constexpr (new_dim::rank == 0) {
-                // The combination of the two dimensions results in a dimension with rank 0, so we can remove it
-                return dimensions_merge<As...>::template merge<AccumulatedDimensionListT, Bs...>();
-            } else {
-                using new_merged_list = typename AccumulatedDimensionListT::template push_back_t<new_dim>;
-                return dimensions_merge<As...>::template merge<new_merged_list, Bs...>();
-            }
-        } else if constexpr (a_before_b) {
-            using new_merged_list = typename AccumulatedDimensionListT::template push_back_t<A>;
-            return dimensions_merge<As...>::template merge<new_merged_list, B, Bs...>();
+// Sorts the dimensions by the keys of their units, and sums the ranks of dimensions with the same unit, leaving out
+// the ones which sum to rank 0. Distinct units can have the same key (e.g. two lambdas in one function), so units are
+// only merged when they are the same type.
+template<dimension_like... DimTs>
+constexpr auto canonical_dimension_entries_of() -> canonical_dimension_entries<sizeof...(DimTs)>
+{
+    static_assert(((DimTs::rank != 0) && ...), "Cannot merge dimensions with rank 0");
+
+    constexpr auto keys =
+        std::array<std::string_view, sizeof...(DimTs)> {stronk_details::type_key<typename DimTs::unit_t>()...};
+    constexpr auto type_ids = std::array<std::size_t, sizeof...(DimTs)> {
+        first_index_of_type<typename DimTs::unit_t, typename DimTs::unit_t...>()...};
+    constexpr auto ranks = std::array<int, sizeof...(DimTs)> {DimTs::rank...};
+    const auto less = [&](std::size_t a, std::size_t b)
+    { return keys[a] < keys[b] || (keys[a] == keys[b] && type_ids[a] < type_ids[b]); };
+
+    // insertion sort, as there are only a handful of dimensions
+    auto order = std::array<std::size_t, sizeof...(DimTs)> {};
+    for (auto i = std::size_t {0}; i < order.size(); i++) {
+        auto j = i;
+        for (; j > 0 && less(i, order[j - 1]); j--) {
+            order[j] = order[j - 1];
+        }
+        order[j] = i;
+    }
+
+    auto merged = canonical_dimension_entries<sizeof...(DimTs)> {};
+    for (auto i : order) {
+        if (merged.size != 0 && type_ids[merged.values[merged.size - 1].index] == type_ids[i]) {
+            merged.values[merged.size - 1].rank += ranks[i];
         } else {
-            using new_merged_list = typename AccumulatedDimensionListT::template push_back_t<B>;
-            return dimensions_merge<A, As...>::template merge<new_merged_list, Bs...>();
+            merged.values[merged.size++] = canonical_dimension_entry {i, ranks[i]};
         }
     }
 
-    template<dimension_like... OtherTs>
-    using merge_t = decltype(merge<empty_dimensions, OtherTs...>());
+    auto res = canonical_dimension_entries<sizeof...(DimTs)> {};
+    for (auto i = std::size_t {0}; i < merged.size; i++) {
+        if (merged.values[i].rank != 0) {
+            res.values[res.size++] = merged.values[i];
+        }
+    }
+    return res;
+}
+
+/**
+ * @brief The sorted and merged dimensions list of the given dimensions, see create_dimensions_t.
+ *
+ * The order is computed by a single constexpr function rather than by recursive template instantiations, so the
+ * instantiation depth does not grow with the number of dimensions.
+ */
+template<dimension_like... DimTs>
+struct canonical_dimensions
+{
+    constexpr static auto entries = canonical_dimension_entries_of<DimTs...>();
+
+    template<std::size_t I>
+    using dimension_at_t =
+        dimension<std::tuple_element_t<entries.values[I].index, std::tuple<typename DimTs::unit_t...>>,
+                  static_cast<int16_t>(entries.values[I].rank)>;
+
+    template<std::size_t... Is>
+    static auto make(std::index_sequence<Is...>) -> dimensions<dimension_at_t<Is>...>;
+
+    using type = decltype(make(std::make_index_sequence<entries.size> {}));
+};
+
+// Class templates rather than aliases, so the compiler memoizes the result for each pair of dimensions
+template<typename DimensionsAT, typename DimensionsBT>
+struct dimensions_multiply;
+
+template<dimension_like... As, dimension_like... Bs>
+struct dimensions_multiply<dimensions<As...>, dimensions<Bs...>>
+{
+    using type = typename canonical_dimensions<As..., Bs...>::type;
+};
+
+template<typename DimensionsAT, typename DimensionsBT>
+struct dimensions_divide
+{
+    using type = typename dimensions_multiply<DimensionsAT, typename DimensionsBT::negate_t>::type;
 };
 
 // Use create_dimensions_t to instantiate this type
@@ -147,22 +193,11 @@ struct dimensions
 
     using negate_t = dimensions<typename Ts::negate_t...>;
 
-    template<dimension_like... Bs>
-    static auto multiply([[maybe_unused]] dimensions<Bs...> dims)
-    {
-        return dimensions_merge<Ts...>::template merge<dimensions<>, Bs...>();
-    }
     template<typename OtherDimensionsT>
-    using multiply_t = decltype(multiply(OtherDimensionsT {}));
+    using multiply_t = typename dimensions_multiply<dimensions, OtherDimensionsT>::type;
 
-    template<dimension_like... Bs>
-    static auto divide([[maybe_unused]] dimensions<Bs...> dims)
-    {
-        using negated_b = typename dimensions<Bs...>::negate_t;
-        return multiply(negated_b {});
-    }
     template<typename OtherDimensionsT>
-    using divide_t = decltype(divide(OtherDimensionsT {}));
+    using divide_t = typename dimensions_divide<dimensions, OtherDimensionsT>::type;
 
     template<auto RootV>
     using root_t = dimensions<typename Ts::template root_t<RootV>...>;
@@ -171,19 +206,6 @@ struct dimensions
     using power_t = dimensions<typename Ts::template power_t<PowerV>...>;
 };
 
-template<typename... ExistingDimTs>
-auto create(dimensions<ExistingDimTs...> dim)
-{
-    return dim;
-}
-
-template<typename... ExistingDimTs, dimension_like Dim, dimension_like... DimTs>
-auto create(dimensions<ExistingDimTs...> dims, [[maybe_unused]] Dim dim_for_type_deduction, DimTs... rest)
-{
-    // Insert each template dimension, merging as we go - this ensures order and uniqueness
-    return create(dims.multiply(details::dimensions<Dim> {}), rest...);
-}
-
 template<typename T>
 struct is_dimensions_type : std::false_type
 {
@@ -202,12 +224,12 @@ concept dimensions_like = details::is_dimensions_type<T>::value;
 
 // Ensures order and uniqueness of dimensions
 template<dimension_like... DimTs>
-auto create_dimensions(DimTs... dims)
+auto create_dimensions([[maybe_unused]] DimTs... dims)
 {
-    return details::create(details::empty_dimensions {}, dims...);
+    return typename details::canonical_dimensions<DimTs...>::type {};
 }
 
 template<dimension_like... DimTs>
-using create_dimensions_t = decltype(create_dimensions(DimTs {}...));
+using create_dimensions_t = typename details::canonical_dimensions<DimTs...>::type;
 
 }  // namespace twig
@@ -3,6 +3,7 @@
 #include <concepts>
 
 #include <stronk/utilities/constexpr_helpers.hpp>
+#include <stronk/utilities/simd.hpp>
 
 namespace twig::stronk_details
 {
@@ -70,4 +71,30 @@ constexpr auto almost_equals(const StronkT& lhs, const StronkT& rhs) noexcept ->
     return twig::stronk_details::is_close(abs_tol, rel_tol, CloseParamsT::nan_equals)(inner_val_1, inner_val_2);
 }
 
+/**
+ * @brief lane-wise version of almost_equals for stronk types wrapping a simd type of floating points
+ *
+ * @return the mask of lanes which are close
+ */
+template<typename CloseParamsT, typename StronkT>
+    requires(simd_like<typename StronkT::underlying_type>)
+constexpr auto almost_equals_lanes(const StronkT& lhs, const StronkT& rhs) noexcept
+{
+    using type = typename StronkT::underlying_type;
+    using scalar_t = simd_scalar_t<type>;
+    static_assert(std::is_floating_point_v<scalar_t>);
+    const auto& inner_val_1 = lhs.template unwrap<StronkT>();
+    const auto& inner_val_2 = rhs.template unwrap<StronkT>();
+
+    constexpr auto abs_tol = CloseParamsT::template abs_tol<scalar_t>();
+    constexpr auto rel_tol = CloseParamsT::template rel_tol<scalar_t>();
+    using std::abs;  // ADL
+    auto val_equals = abs(inner_val_1 - inner_val_2) <= (type(abs_tol) + (type(rel_tol) * abs(inner_val_2)));
+    if constexpr (CloseParamsT::nan_equals) {
+        using std::isnan;  // ADL
+        val_equals = val_equals || (isnan(inner_val_1) && isnan(inner_val_2));
+    }
+    return val_equals;
+}
+
 }  // namespace twig::stronk_details
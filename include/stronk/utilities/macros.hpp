@@ -3,13 +3,17 @@
 #if defined(_MSC_VER)
 #    define STRONK_EMPTY_BASES __declspec(empty_bases)
 #    define STRONK_FORCEINLINE __forceinline  // NOLINT
+#    define STRONK_VECTORIZE_LOOP __pragma(loop(ivdep))  // NOLINT
 #elif defined(__clang__)
 #    define STRONK_EMPTY_BASES
 #    define STRONK_FORCEINLINE __attribute__((always_inline))  // NOLINT
+#    define STRONK_VECTORIZE_LOOP _Pragma("clang loop vectorize(assume_safety) interleave(enable)")  // NOLINT
 #elif defined(__GNUC__)
 #    define STRONK_EMPTY_BASES
 #    define STRONK_FORCEINLINE __attribute__((always_inline))  // NOLINT
+#    define STRONK_VECTORIZE_LOOP _Pragma("GCC ivdep")  // NOLINT
 #else
 #    define STRONK_EMPTY_BASES
 #    define STRONK_FORCEINLINE  // NOLINT
+#    define STRONK_VECTORIZE_LOOP  // NOLINT
 #endif
@@ -31,6 +31,11 @@ constexpr auto gcd(const auto& self, const auto& other) -> auto
     return a;
 }
 
+constexpr auto lcm(const auto& self, const auto& other) -> auto
+{
+    return self / gcd(self, other) * other;
+}
+
 // Compile-time integer square root using binary search
 // https://baptiste-wicht.com/posts/2014/07/compile-integer-square-roots-at-compile-time-in-cpp.html
 constexpr auto isqrt(u_biggest_int_t n) -> u_biggest_int_t
@@ -91,6 +96,11 @@ using ratio_multiply =
 template<typename Ratio1, typename Ratio2>
 using ratio_divide = typename ratio<Ratio1::type::num * Ratio2::type::den, Ratio1::type::den * Ratio2::type::num>::type;
 
+// The largest ratio which both ratios are integer multiples of, like the common type of two std::chrono::durations
+template<typename Ratio1, typename Ratio2>
+using ratio_common = typename ratio<stronk_details::gcd(Ratio1::type::num, Ratio2::type::num),
+                                    stronk_details::lcm(Ratio1::type::den, Ratio2::type::den)>::type;
+
 template<typename RatioT>
 using ratio_sqrt =
     typename ratio<stronk_details::isqrt(RatioT::type::num), stronk_details::isqrt(RatioT::type::den)>::type;
@@ -0,0 +1,229 @@
+#pragma once
+#include <concepts>
+#include <limits>
+#include <type_traits>
+
+#include "stronk/utilities/macros.hpp"
+#include "stronk/utilities/ratio.hpp"
+#include "stronk/utilities/simd.hpp"
+
+namespace twig::stronk_details
+{
+
+// a ratio component as T, or 0 if it is out of range of T
+template<typename T>
+constexpr auto ratio_component_as(u_biggest_int_t value) noexcept -> T
+{
+    return value > static_cast<u_biggest_int_t>(std::numeric_limits<T>::max()) ? T {0} : static_cast<T>(value);
+}
+
+// Exact conversion of integers by num / den, see scale_converter
+template<std::integral T, u_biggest_int_t NumV, u_biggest_int_t DenV>
+struct integral_scale_converter
+{
+    using limits = std::numeric_limits<T>;
+    using unsigned_t = std::make_unsigned_t<std::conditional_t<std::is_same_v<T, bool>, int, T>>;
+
+    constexpr static auto num_t = ratio_component_as<T>(NumV);
+    constexpr static auto den_t = ratio_component_as<T>(DenV);
+
+    // |min| of signed types is the one ratio component out of range of T which still multiplies or divides values of T
+    // into range: -1 * 128 == -128 and -128 / 128 == -1 for int8_t
+    constexpr static auto is_min_magnitude(u_biggest_int_t component) noexcept -> bool
+    {
+        if constexpr (std::is_signed_v<T>) {
+            return component == static_cast<u_biggest_int_t>(limits::max()) + 1U;
+        } else {
+            return false;
+        }
+    }
+
+    // the range of values which can be multiplied by num without overflowing
+    constexpr static auto max_quotient = num_t == T {0} ? T {0} : static_cast<T>(limits::max() / num_t);
+    constexpr static auto min_quotient = []() -> T
+    {
+        if constexpr (std::is_signed_v<T>) {
+            if (is_min_magnitude(NumV)) {
+                return T {-1};
+            }
+        }
+        return num_t == T {0} ? T {0} : static_cast<T>(limits::min() / num_t);
+    }();
+
+    // products which might overflow are done unsigned, so overflowing values wrap instead of being UB
+    STRONK_FORCEINLINE constexpr static auto wrapping_multiply(T value) noexcept -> T
+    {
+        return static_cast<T>(static_cast<unsigned_t>(value) * static_cast<unsigned_t>(NumV));
+    }
+
+    // whether values can be converted exactly without widening, see apply
+    constexpr static bool is_exact_without_widening =
+        DenV == 1 || NumV == 1 || (DenV - 1) * NumV <= static_cast<u_biggest_int_t>(limits::max());
+
+    STRONK_FORCEINLINE constexpr static auto apply(const T& value, bool& overflowed) noexcept -> T
+    {
+        if constexpr (DenV == 1) {
+            overflowed |= (value > max_quotient) | (value < min_quotient);
+            return wrapping_multiply(value);
+        } else if constexpr (NumV == 1) {
+            if constexpr (is_min_magnitude(DenV)) {
+                return value == limits::min() ? T {-1} : T {0};
+            } else {
+                return den_t == T {0} ? T {0} : static_cast<T>(value / den_t);
+            }
+        } else {
+            // value * num / den == q * num + r * num / den, where value = q * den + r, which is exact without
+            // widening as long as r * num fits in T
+            static_assert(is_exact_without_widening,
+                          "the scale ratio is too large to convert this integer type exactly");
+            constexpr auto max_rest = static_cast<T>(limits::max() - (max_quotient * num_t));
+            constexpr auto min_rest = static_cast<T>(limits::min() - (min_quotient * num_t));
+
+            const auto quotient = static_cast<T>(value / den_t);
+            const auto rest = static_cast<T>(static_cast<T>(value % den_t) * num_t / den_t);
+            overflowed |= (quotient > max_quotient) | (quotient < min_quotient)
+                | ((quotient == max_quotient) & (rest > max_rest)) | ((quotient == min_quotient) & (rest < min_rest));
+            return static_cast<T>(static_cast<unsigned_t>(wrapping_multiply(quotient)) + static_cast<unsigned_t>(rest));
+        }
+    }
+};
+
+// whether the integer value is exactly representable by the floating point type T
+template<std::floating_point T>
+constexpr auto is_exactly_representable(u_biggest_int_t value) noexcept -> bool
+{
+    constexpr auto digits = std::numeric_limits<T>::digits;
+    if constexpr (digits >= std::numeric_limits<u_biggest_int_t>::digits) {
+        return true;
+    } else {
+        while (value != 0 && value % 2 == 0) {
+            value /= 2;
+        }
+        return value < (u_biggest_int_t {1} << static_cast<unsigned>(digits));
+    }
+}
+
+/**
+ * @brief Controls when scalar scale conversions (`unit::value::to()`) of the floating point type T are folded into a
+ * single multiply.
+ *
+ * Folding rounds the factor `num / den` before multiplying, so unless the factor is exact (`den` is a power of 2)
+ * the folded result can be 1 ULP off from the correctly rounded `value * num / den`, e.g. 3 decimeters become
+ * 0.30000000000000004 meters rather than 0.3. By default only exact factors are folded. Specialize this struct with
+ * `max_ulp = 1` to fold all factors of T, trading that ULP for a multiply instead of a divide.
+ */
+template<typename T>
+struct scale_folding_policy
+{
+    constexpr static unsigned max_ulp = 0;
+};
+
+/**
+ * @brief Controls when the bulk scale conversions of `twig::convert` of the floating point type T are folded into a
+ * single multiply. Unlike `scale_folding_policy` all factors are folded by default, as a loop of multiplies is several
+ * times faster than one of divides, so results of inexact factors can be 1 ULP off from `value.to<>()`. Specialize
+ * this struct with `max_ulp = 0` to only fold exact factors.
+ */
+template<typename T>
+struct bulk_scale_folding_policy
+{
+    constexpr static unsigned max_ulp = 1;
+};
+
+/**
+ * @brief Converts raw values of type T between two scales, with the conversion ratio folded at compile time.
+ *
+ * Floating points (and simd types of those) multiply by a single precomputed factor when it is exact or when
+ * `FoldingPolicyT` allows it, and are otherwise multiplied by num and divided by den. Integers are converted exactly
+ * (truncating toward zero like `value * num / den`) without any hardware divide, as divisions by compile-time
+ * constants become multiplications. The integer conversion reports whether the result did not fit in T through
+ * `overflowed`, and is written without branches, so loops over it vectorize.
+ *
+ * @tparam FoldingPolicyT a template like `scale_folding_policy`, giving the ULPs a folded conversion may be off by
+ */
+template<typename FromScaleT,
+         typename ToScaleT,
+         typename T,
+         template<typename> typename FoldingPolicyT = scale_folding_policy>
+struct scale_converter
+{
+    using ratio_t = twig::ratio_divide<FromScaleT, ToScaleT>;
+    constexpr static auto num = ratio_t::num;
+    constexpr static auto den = ratio_t::den;
+    constexpr static bool is_identity = num == 1 && den == 1;
+    using scalar_t = simd_scalar_t<T>;
+
+    // Converts a single value without overflow detection, used by `unit::value::to()`. Integer ratios which cannot be
+    // converted exactly without widening keep the spelled out `value * num / den`.
+    STRONK_FORCEINLINE constexpr static auto apply(const T& value) noexcept -> T
+    {
+        if constexpr (is_spelled_out_without_overflow_detection()) {
+            return spelled_out(value);
+        } else {
+            auto overflowed = false;
+            return apply(value, overflowed);
+        }
+    }
+
+    STRONK_FORCEINLINE constexpr static auto apply(const T& value, bool& overflowed) noexcept -> T
+    {
+        if constexpr (is_identity) {
+            return value;
+        } else if constexpr (std::is_floating_point_v<scalar_t>) {
+            if constexpr (is_folded()) {
+                return value * factor();
+            } else {
+                return spelled_out(value);
+            }
+        } else if constexpr (std::is_integral_v<T>) {
+            return integral_scale_converter<T, num, den>::apply(value, overflowed);
+        } else {
+            // user defined (and integral simd) underlying types get the conversion spelled out
+            return spelled_out(value);
+        }
+    }
+
+    // The folded factor for floating points, rounded once from the exact ratio.
+    [[nodiscard]]
+    constexpr static auto factor() noexcept -> scalar_t
+        requires(std::is_floating_point_v<scalar_t>)
+    {
+        return static_cast<scalar_t>(static_cast<long double>(num) / static_cast<long double>(den));
+    }
+
+    // Whether the folded factor is exactly num / den, in which case folding gives the same results as spelling it out
+    [[nodiscard]]
+    constexpr static auto factor_is_exact() noexcept -> bool
+        requires(std::is_floating_point_v<scalar_t>)
+    {
+        return (den & (den - 1)) == 0 && is_exactly_representable<scalar_t>(num);
+    }
+
+    // Whether floating points multiply by `factor()` rather than by num and then divide by den
+    [[nodiscard]]
+    constexpr static auto is_folded() noexcept -> bool
+        requires(std::is_floating_point_v<scalar_t>)
+    {
+        return factor_is_exact() || FoldingPolicyT<scalar_t>::max_ulp >= 1;
+    }
+
+  private:
+    constexpr static auto is_spelled_out_without_overflow_detection() noexcept -> bool
+    {
+        if constexpr (std::is_integral_v<T> && !is_identity) {
+            return !integral_scale_converter<T, num, den>::is_exact_without_widening;
+        } else {
+            return false;
+        }
+    }
+
+    // cast via the lane type, simd types only broadcast from value preserving conversions
+    STRONK_FORCEINLINE constexpr static auto spelled_out(const T& value) noexcept -> T
+    {
+        // integers smaller than int are promoted by the arithmetic
+        return static_cast<T>(value * static_cast<T>(static_cast<scalar_t>(num))
+                              / static_cast<T>(static_cast<scalar_t>(den)));
+    }
+};
+
+}  // namespace twig::stronk_details
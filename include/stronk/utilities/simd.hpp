@@ -0,0 +1,43 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+namespace twig
+{
+
+/**
+ * @brief Matches data-parallel types such as `std::experimental::simd<T, Abi>` and `std::simd<T, Abi>`.
+ *
+ * Detected structurally so stronk does not need to include `<experimental/simd>` itself. Operations on these types are
+ * element-wise, so comparisons return a `mask_type` rather than a `bool`.
+ */
+template<typename T>
+concept simd_like = requires {
+    typename T::value_type;
+    typename T::mask_type;
+    { T::size() } -> std::convertible_to<std::size_t>;
+};
+
+namespace stronk_details
+{
+
+template<typename T>
+struct simd_scalar
+{
+    using type = T;
+};
+
+template<simd_like T>
+struct simd_scalar<T>
+{
+    using type = typename T::value_type;
+};
+
+}  // namespace stronk_details
+
+// The type of each lane for simd types, or the type itself otherwise.
+template<typename T>
+using simd_scalar_t = typename stronk_details::simd_scalar<T>::type;
+
+}  // namespace twig
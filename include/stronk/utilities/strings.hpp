@@ -2,6 +2,7 @@
 #include <array>
 #include <cstddef>
 #include <string_view>
+#include <type_traits>
 
 namespace twig::stronk_details::str
 {
@@ -19,6 +20,11 @@ struct string_literal
         }
     }
 
+    consteval explicit string_literal(const std::array<char, N>& str) noexcept
+        : value(str)
+    {
+    }
+
     constexpr explicit operator std::string_view() const noexcept
     {
         return std::string_view {this->value.data(), N - 1};
@@ -30,4 +36,57 @@ struct string_literal
     }
 };
 
+// A fixed capacity string for building strings in constant expressions.
+template<size_t CapacityV>
+struct string_builder
+{
+    std::array<char, CapacityV> value {};
+    size_t size = 0;
+
+    constexpr void append(std::string_view str)
+    {
+        for (auto c : str) {
+            this->value[this->size++] = c;
+        }
+    }
+
+    // Appends the decimal digits of the integer
+    template<typename IntT>
+    constexpr void append_integer(IntT integer)
+    {
+        if constexpr (std::is_signed_v<IntT>) {
+            if (integer < 0) {
+                this->append("-");
+                integer = -integer;
+            }
+        }
+        auto digits = std::array<char, 40> {};
+        auto count = size_t {0};
+        do {
+            digits[count++] = static_cast<char>('0' + static_cast<int>(integer % 10));
+            integer /= 10;
+        } while (integer != 0);
+        while (count > 0) {
+            this->value[this->size++] = digits[--count];
+        }
+    }
+
+    [[nodiscard]]
+    constexpr auto view() const noexcept -> std::string_view
+    {
+        return std::string_view {this->value.data(), this->size};
+    }
+};
+
+// The built string as a string_literal of exactly its size, for use as a constant with static storage.
+template<size_t SizeV, size_t CapacityV>
+consteval auto to_string_literal(const string_builder<CapacityV>& builder) -> string_literal<SizeV + 1>
+{
+    auto chars = std::array<char, SizeV + 1> {};
+    for (auto i = size_t {0}; i < SizeV; i++) {
+        chars[i] = builder.value[i];
+    }
+    return string_literal<SizeV + 1> {chars};
+}
+
 }  // namespace twig::stronk_details::str
@@ -1,3 +1,6 @@
+#include <cstdint>
+#include <vector>
+
 #include "stronk/extensions/absl.hpp"
 
 #include <absl/hash/hash.h>
@@ -21,6 +24,48 @@ TEST_SUITE("can_absl_hash")
             CHECK_EQ(absl::HashOf(a_can_absl_hash_type(i)), absl::HashOf(i));
         }
     }
+
+    struct an_absl_hashed_id : stronk<an_absl_hashed_id, int64_t, can_equate, can_absl_hash>
+    {
+        using stronk::stronk;
+    };
+
+    struct an_absl_hashed_price : stronk<an_absl_hashed_price, double, can_equate, can_absl_hash>
+    {
+        using stronk::stronk;
+    };
+
+    struct a_type_without_absl_hash : stronk<a_type_without_absl_hash, int64_t, can_equate>
+    {
+        using stronk::stronk;
+    };
+
+    TEST_CASE("stronk_integers_are_uniquely_represented_so_ranges_are_hashed_as_bytes")
+    {
+        static_assert(absl::hash_internal::is_uniquely_represented<an_absl_hashed_id>::value);
+        static_assert(absl::hash_internal::is_uniquely_represented<a_can_absl_hash_type>::value);
+        // -0.0 and 0.0 are equal with different bytes, and only opted in types are hashable by absl
+        static_assert(!absl::hash_internal::is_uniquely_represented<an_absl_hashed_price>::value);
+        static_assert(!absl::hash_internal::is_uniquely_represented<a_type_without_absl_hash>::value);
+
+        auto ids = std::vector<an_absl_hashed_id> {};
+        auto raw_ids = std::vector<int64_t> {};
+        for (auto i = int64_t {0}; i < 100; i++) {
+            ids.emplace_back(i * 3);
+            raw_ids.push_back(i * 3);
+        }
+        CHECK_EQ(absl::HashOf(ids), absl::HashOf(raw_ids));
+        CHECK_EQ(absl::HashOf(an_absl_hashed_id {7}), absl::HashOf(int64_t {7}));
+        CHECK_NE(absl::HashOf(ids), absl::HashOf(std::vector<an_absl_hashed_id>(ids.begin(), ids.end() - 1)));
+    }
+
+    TEST_CASE("stronk_floating_points_are_still_hashed_element_wise")
+    {
+        const auto prices = std::vector<an_absl_hashed_price> {an_absl_hashed_price {0.0}, an_absl_hashed_price {1.5}};
+        const auto negative_zero_prices =
+            std::vector<an_absl_hashed_price> {an_absl_hashed_price {-0.0}, an_absl_hashed_price {1.5}};
+        CHECK_EQ(absl::HashOf(prices), absl::HashOf(negative_zero_prices));
+    }
 }
 
 }  // namespace twig
@@ -1,11 +1,17 @@
 #include <fmt/format.h>
 #if !defined(__GNUC__) || defined(__clang__) || (__GNUC__ >= 12)
 
+#    include <iterator>
+#    include <string>
+#    include <string_view>
+
 #    include <doctest/doctest.h>
 #    include <fmt/core.h>
 
 #    include "stronk/extensions/fmt.hpp"
 #    include "stronk/stronk.hpp"
+#    include "stronk/unit.hpp"
+#    include "stronk/utilities/ratio.hpp"
 
 namespace twig
 {
@@ -36,6 +42,16 @@ TEST_SUITE("can_fmt_format_builder")
         CHECK_EQ(fmt::format("{}", a_float_formattable_type {42.0F}), "42.0000");
         CHECK_EQ(fmt::format("{:*^30}", a_float_formattable_type {42.0F}), "***********42.0000************");
     }
+
+    TEST_CASE("custom_format_strings_are_written_directly_to_the_output")
+    {
+        auto out = std::string {"values:"};
+        fmt::format_to(std::back_inserter(out), " {} {}", a_formattable_type {1}, a_float_formattable_type {0.5F});
+        CHECK_EQ(out, "values: a_formattable_type(1) 0.5000");
+        CHECK_EQ(fmt::format("[{:<24}]", a_formattable_type {7}), "[a_formattable_type(7)   ]");
+        CHECK_EQ(fmt::format("{:>8}|{}", a_float_formattable_type {1.0F}, a_float_formattable_type {2.0F}),
+                 "  1.0000|2.0000");
+    }
 }
 
 struct a_default_formattable_type : stronk<a_default_formattable_type, int, can_fmt_format>
@@ -63,6 +79,39 @@ TEST_SUITE("can_fmt_format")
     }
 }
 
+struct fmt_watt_hours : stronk_default_unit<fmt_watt_hours, ratio<1>>
+{
+    constexpr static std::string_view symbol = "Wh";
+};
+
+struct fmt_euros : stronk_default_unit<fmt_euros, ratio<1>>
+{
+    constexpr static std::string_view symbol = "EUR";
+    constexpr static bool si_prefixable = false;
+};
+
+struct fmt_symbol_less_unit : stronk_default_unit<fmt_symbol_less_unit, ratio<1>>
+{
+};
+
+TEST_SUITE("unit_symbol")
+{
+    TEST_CASE("unit_values_with_symbols_are_formatted_with_the_symbol")
+    {
+        using mega_watt_hours = fmt_watt_hours::scaled_t<mega>;
+        CHECK_EQ(fmt::format("{}", mega_watt_hours::value<double> {12.5}), "12.5 MWh");
+        CHECK_EQ(fmt::format("{}", divided_unit_t<fmt_euros, mega_watt_hours>::value<int> {300}), "300 EUR/MWh");
+        CHECK_EQ(fmt::format("{:.2f}", fmt_watt_hours::value<double> {1.0 / 3.0}), "0.33 Wh");
+        CHECK_EQ(fmt::format("{:>5}|", fmt_euros::value<int> {42}), "   42 EUR|");
+    }
+
+    TEST_CASE("unit_values_without_symbols_are_formatted_as_numbers")
+    {
+        CHECK_EQ(fmt::format("{}", fmt_symbol_less_unit::value<int> {7}), "7");
+        CHECK_EQ(fmt::format("{}", multiplied_unit_t<fmt_symbol_less_unit, fmt_euros>::value<int> {7}), "7");
+    }
+}
+
 }  // namespace twig
 
 #endif
@@ -1,16 +1,24 @@
 #if !defined(__GNUC__) || defined(__clang__) || (__GNUC__ >= 13)
 
+#    include <algorithm>
 #    include <cstdint>
 #    include <string>
+#    include <vector>
 
 #    include "stronk/extensions/glaze.hpp"
 
 #    include <doctest/doctest.h>
+#    include <glaze/beve/read.hpp>
+#    include <glaze/beve/write.hpp>
 #    include <glaze/core/common.hpp>
 #    include <glaze/json/read.hpp>
 #    include <glaze/json/write.hpp>
 
+#    include "stronk/prefabs/stronk_vector.hpp"
 #    include "stronk/stronk.hpp"
+#    include "stronk/unit.hpp"
+#    include "stronk/unit_vector.hpp"
+#    include "stronk/utilities/ratio.hpp"
 
 namespace twig
 {
@@ -98,6 +106,73 @@ TEST_SUITE("can_glaze_de_and_serialize")
         CHECK_EQ(R"({"val1":24,"val2":"world"})", json_str_opt.value());
         CHECK_EQ(val, glz::read_json<a_class_with_two_can_glaze_members>(json_str_opt.value()).value());
     }
+
+    struct glaze_watts : stronk_default_unit<glaze_watts, ratio<1>>
+    {
+    };
+
+    using glaze_watts_t = glaze_watts::value<double>;
+    using glaze_watts_vector_t = unit_vector<glaze_watts, double>;
+
+    struct a_stronk_vector_of_watts : stronk_vector<a_stronk_vector_of_watts, glaze_watts_t>
+    {
+        using stronk::stronk;
+    };
+
+    TEST_CASE("vectors_of_stronk_numbers_are_beve_typed_arrays_of_the_underlying_type")
+    {
+        const auto values = std::vector<glaze_watts_t> {glaze_watts_t {1.5}, glaze_watts_t {-2.0}, glaze_watts_t {1e9}};
+        const auto beve = glz::write_beve(values);
+        REQUIRE(beve.has_value());
+        // the same bytes as glaze writes for the raw numbers, so either can read what the other wrote
+        CHECK_EQ(beve.value(), glz::write_beve(std::vector<double> {1.5, -2.0, 1e9}).value());
+
+        const auto read_values = glz::read_beve<std::vector<glaze_watts_t>>(beve.value());
+        REQUIRE(read_values.has_value());
+        CHECK_EQ(read_values.value(), values);
+    }
+
+    TEST_CASE("large_vectors_of_stronk_numbers_roundtrip_through_beve")
+    {
+        auto values = std::vector<glaze_watts_t> {};
+        for (auto i = 0; i < 100'000; i++) {
+            values.emplace_back(static_cast<double>(i) * 0.25);
+        }
+        const auto val = a_stronk_vector_of_watts {values};
+        const auto beve = glz::write_beve(val);
+        REQUIRE(beve.has_value());
+
+        const auto read_val = glz::read_beve<a_stronk_vector_of_watts>(beve.value());
+        REQUIRE(read_val.has_value());
+        CHECK_EQ(read_val.value(), val);
+    }
+
+    TEST_CASE("beve_arrays_of_other_types_and_truncated_arrays_are_rejected")
+    {
+        const auto beve = glz::write_beve(std::vector<float> {1.0F, 2.0F}).value();
+        CHECK_FALSE(glz::read_beve<std::vector<glaze_watts_t>>(beve).has_value());
+
+        const auto truncated = glz::write_beve(std::vector<glaze_watts_t>(10)).value().substr(0, 20);
+        CHECK_FALSE(glz::read_beve<std::vector<glaze_watts_t>>(truncated).has_value());
+    }
+
+    TEST_CASE("unit_vectors_are_read_and_written_as_arrays_of_numbers")
+    {
+        const auto val = glaze_watts_vector_t {glaze_watts_t {1.5}, glaze_watts_t {2.5}, glaze_watts_t {-3.0}};
+
+        const auto json = glz::write_json(val);
+        REQUIRE(json.has_value());
+        CHECK_EQ(json.value(), "[1.5,2.5,-3]");
+        const auto read_json_val = glz::read_json<glaze_watts_vector_t>(json.value());
+        REQUIRE(read_json_val.has_value());
+        CHECK(std::ranges::equal(read_json_val.value(), val));
+
+        const auto beve = glz::write_beve(val);
+        REQUIRE(beve.has_value());
+        const auto read_beve_val = glz::read_beve<glaze_watts_vector_t>(beve.value());
+        REQUIRE(read_beve_val.has_value());
+        CHECK(std::ranges::equal(read_beve_val.value(), val));
+    }
 }
 
 }  // namespace twig
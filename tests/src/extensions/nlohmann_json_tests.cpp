@@ -1,4 +1,9 @@
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "stronk/extensions/nlohmann_json.hpp"
 
@@ -7,6 +12,9 @@
 #include <nlohmann/json_fwd.hpp>
 
 #include "stronk/stronk.hpp"
+#include "stronk/unit.hpp"
+#include "stronk/unit_vector.hpp"
+#include "stronk/utilities/ratio.hpp"
 
 namespace twig
 {
@@ -40,6 +48,69 @@ TEST_SUITE("can_nlohmann_json")
         CHECK_EQ(R"({"string":"hello"})", json_val.dump());
         CHECK_EQ(val, json_val.at("string").get<a_string_can_nlohmann_json>());
     }
+
+    struct nlohmann_euros : stronk_default_unit<nlohmann_euros, ratio<1>>
+    {
+    };
+
+    using euros_t = nlohmann_euros::value<double>;
+    using euros_vector_t = unit_vector<nlohmann_euros, double>;
+
+    TEST_CASE("json_arrays_are_streamed_into_containers_of_stronk_values")
+    {
+        auto stream = std::istringstream {"[1.5, -2, 3e2, 4]"};
+        const auto values = read_json_array<std::vector<euros_t>>(stream);
+        CHECK_EQ(values, std::vector<euros_t> {euros_t {1.5}, euros_t {-2.0}, euros_t {300.0}, euros_t {4.0}});
+
+        const auto vector = read_json_array<euros_vector_t>(std::string {"[]"});
+        CHECK(vector.empty());
+    }
+
+    TEST_CASE("the_array_of_a_key_is_streamed_while_the_other_values_are_skipped")
+    {
+        const auto json = std::string {
+            R"({"area": "DK1", "meta": {"prices": [9]}, "series": [[1]], "prices": [10.5, 20], "count": 2})"};
+        auto sum = 0.0;
+        auto calls = 0;
+        for_each_json_number<euros_t>(
+            json,
+            [&](euros_t value)
+            {
+                sum += value.unwrap<euros_t>();
+                calls++;
+            },
+            "prices");
+        CHECK_EQ(calls, 2);
+        CHECK_EQ(sum, 30.5);
+    }
+
+    TEST_CASE("integers_are_checked_to_fit")
+    {
+        CHECK_EQ(read_json_array<std::vector<a_can_nlohmann_json>>(std::string {"[1, -2]"}),
+                 std::vector<a_can_nlohmann_json> {a_can_nlohmann_json {1}, a_can_nlohmann_json {-2}});
+        CHECK_THROWS_WITH_AS((void)read_json_array<std::vector<a_can_nlohmann_json>>(std::string {"[1, 5000000000]"}),
+                             "element 1 of the array is out of range",
+                             std::invalid_argument);
+        CHECK_THROWS_WITH_AS((void)read_json_array<std::vector<a_can_nlohmann_json>>(std::string {"[1.5]"}),
+                             "element 0 of the array is not an integer",
+                             std::invalid_argument);
+        CHECK_EQ(read_json_array<std::vector<uint8_t>>(std::string {"[255]"}), std::vector<uint8_t> {255});
+    }
+
+    TEST_CASE("json_without_an_array_of_numbers_is_rejected")
+    {
+        const auto read = [](const std::string& json, std::string_view key = {})
+        { return read_json_array<std::vector<euros_t>>(json, key); };
+        CHECK_THROWS_WITH_AS((void)read("[1, \"2\"]"), "element 1 of the array is not a number", std::invalid_argument);
+        CHECK_THROWS_WITH_AS((void)read("[1, [2]]"), "element 1 of the array is not a number", std::invalid_argument);
+        CHECK_THROWS_WITH_AS((void)read(R"({"a": 1})"), "the JSON is not an array", std::invalid_argument);
+        CHECK_THROWS_WITH_AS((void)read("[1, 2]", "a"), "the JSON is not an object", std::invalid_argument);
+        CHECK_THROWS_WITH_AS(
+            (void)read(R"({"a": 1})", "a"), "the value of the key 'a' is not an array", std::invalid_argument);
+        CHECK_THROWS_WITH_AS(
+            (void)read(R"({"b": [1]})", "a"), "the JSON has no array at the key 'a'", std::invalid_argument);
+        CHECK_THROWS_AS((void)read("[1, 2"), std::invalid_argument);
+    }
 }
 
 }  // namespace twig
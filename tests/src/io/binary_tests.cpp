@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "stronk/io/binary.hpp"
+
+#include <doctest/doctest.h>
+
+#include "stronk/stronk.hpp"
+#include "stronk/unit.hpp"
+#include "stronk/utilities/crc32c.hpp"
+#include "stronk/utilities/ratio.hpp"
+
+namespace twig
+{
+
+namespace
+{
+
+struct binary_meters : stronk_default_unit<binary_meters, ratio<1>>
+{
+};
+
+struct binary_seconds : stronk_default_unit<binary_seconds, ratio<1>>
+{
+};
+
+struct binary_id : stronk<binary_id, int64_t, can_equate>
+{
+    using stronk::stronk;
+};
+
+using binary_speed = divided_unit_t<binary_meters, binary_seconds>;
+using meters_t = binary_meters::value<double>;
+using kilometers_t = unit_scaled_value_t<kilo, binary_meters, double>;
+
+}  // namespace
+
+static_assert(binary_serializable<double>);
+static_assert(binary_serializable<meters_t>);
+static_assert(binary_serializable<binary_id>);
+static_assert(!binary_serializable<bool>);
+static_assert(binary_header::size == sizeof(binary_header::magic) + 28);
+
+static_assert(binary_fingerprint<meters_t>() == binary_fingerprint<meters_t>());
+static_assert(binary_fingerprint<meters_t>() != binary_fingerprint<kilometers_t>());
+static_assert(binary_fingerprint<meters_t>() != binary_fingerprint<binary_meters::value<float>>());
+static_assert(binary_fingerprint<meters_t>() != binary_fingerprint<binary_seconds::value<double>>());
+static_assert(binary_fingerprint<meters_t>() != binary_fingerprint<double>());
+static_assert(binary_fingerprint<binary_speed::value<double>>() != binary_fingerprint<meters_t>());
+static_assert(binary_fingerprint<binary_id>() != binary_fingerprint<int64_t>());
+static_assert(binary_fingerprint<int32_t>() != binary_fingerprint<uint32_t>());
+// the fingerprint only depends on the dimensions, so the units composed in different orders are the same
+static_assert(
+    binary_fingerprint<multiplied_unit_t<binary_meters, binary_seconds>::value<double>>()
+    == binary_fingerprint<multiplied_unit_t<binary_seconds, binary_meters>::value<double>>());
+
+namespace
+{
+
+template<typename T>
+auto to_bytes(const std::vector<T>& values, binary_checksum checksum = binary_checksum::none)
+    -> std::vector<std::byte>
+{
+    auto stream = std::ostringstream {};
+    write_binary(stream, std::span<const T> {values}, checksum);
+    const auto str = stream.str();
+    auto bytes = std::vector<std::byte>(str.size());
+    std::transform(str.begin(), str.end(), bytes.begin(), [](char c) { return static_cast<std::byte>(c); });
+    return bytes;
+}
+
+// Rewrites the bytes as if they were written on a platform with the other byte order
+template<typename T>
+void flip_byte_order(std::vector<std::byte>& bytes)
+{
+    auto header = binary_header::from_bytes(bytes);
+    for (auto it = bytes.begin() + binary_header::size; it != bytes.end(); it += sizeof(T)) {
+        std::reverse(it, it + sizeof(T));
+    }
+    header.flags ^= binary_header::big_endian_flag;
+    if (header.has_checksum()) {
+        header.checksum = stronk_details::crc32c(std::span {bytes}.subspan(binary_header::size));
+    }
+    const auto header_bytes = header.to_bytes();
+    std::copy(header_bytes.begin(), header_bytes.end(), bytes.begin());
+}
+
+}  // namespace
+
+TEST_SUITE("binary")
+{
+    TEST_CASE("values_are_written_after_a_header_and_viewed_without_copying")
+    {
+        const auto values = std::vector<meters_t> {meters_t {1.5}, meters_t {-2.0}, meters_t {1e10}};
+        const auto bytes = to_bytes(values);
+        CHECK_EQ(bytes.size(), binary_header::size + (values.size() * sizeof(meters_t)));
+
+        const auto view = view_binary<meters_t>(std::span<const std::byte> {bytes});
+        REQUIRE_EQ(view.size(), values.size());
+        CHECK(std::equal(view.begin(), view.end(), values.begin()));
+        CHECK_EQ(static_cast<const void*>(view.data()), static_cast<const void*>(bytes.data() + binary_header::size));
+    }
+
+    TEST_CASE("values_can_be_read_from_a_stream")
+    {
+        const auto values = std::vector<binary_id> {binary_id {1}, binary_id {-42}, binary_id {1LL << 40}};
+        auto stream = std::stringstream {};
+        write_binary(stream, std::span<const binary_id> {values}, binary_checksum::crc32c);
+        CHECK(read_binary<binary_id>(stream) == values);
+    }
+
+    TEST_CASE("empty_spans_round_trip")
+    {
+        const auto bytes = to_bytes(std::vector<meters_t> {}, binary_checksum::crc32c);
+        CHECK(view_binary<meters_t>(std::span<const std::byte> {bytes}).empty());
+    }
+
+    TEST_CASE("values_of_another_type_are_rejected")
+    {
+        const auto bytes = to_bytes(std::vector<meters_t> {meters_t {1.0}});
+        const auto view = std::span<const std::byte> {bytes};
+        CHECK_THROWS_AS((void)view_binary<kilometers_t>(view), std::invalid_argument);
+        CHECK_THROWS_AS((void)view_binary<binary_seconds::value<double>>(view), std::invalid_argument);
+        CHECK_THROWS_AS((void)view_binary<double>(view), std::invalid_argument);
+        CHECK_THROWS_AS((void)view_binary<int64_t>(view), std::invalid_argument);
+    }
+
+    TEST_CASE("malformed_bytes_are_rejected")
+    {
+        auto bytes = to_bytes(std::vector<meters_t> {meters_t {1.0}, meters_t {2.0}});
+
+        SUBCASE("truncated")
+        {
+            bytes.pop_back();
+        }
+        SUBCASE("no_header")
+        {
+            bytes.resize(binary_header::size - 1);
+        }
+        SUBCASE("bad_magic")
+        {
+            bytes[0] = std::byte {'X'};
+        }
+        SUBCASE("unsupported_version")
+        {
+            bytes[sizeof(binary_header::magic)] = std::byte {99};
+        }
+        CHECK_THROWS_AS((void)view_binary<meters_t>(std::span<const std::byte> {bytes}), std::invalid_argument);
+    }
+
+    TEST_CASE("streams_with_fewer_values_than_their_header_count_are_rejected_without_allocating_the_count")
+    {
+        auto bytes = to_bytes(std::vector<meters_t> {meters_t {1.0}, meters_t {2.0}});
+        auto header = binary_header::from_bytes(bytes);
+        header.count = std::uint64_t {1} << 60U;
+        const auto header_bytes = header.to_bytes();
+        std::copy(header_bytes.begin(), header_bytes.end(), bytes.begin());
+
+        auto stream = std::stringstream {};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        stream.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        CHECK_THROWS_AS((void)read_binary<meters_t>(stream), std::invalid_argument);
+    }
+
+    TEST_CASE("misaligned_values_are_rejected")
+    {
+        const auto bytes = to_bytes(std::vector<meters_t> {meters_t {1.0}});
+        auto shifted = std::vector<std::byte>(bytes.size() + 1);
+        std::copy(bytes.begin(), bytes.end(), shifted.begin() + 1);
+        CHECK_THROWS_AS((void)view_binary<meters_t>(std::span<const std::byte> {shifted}.subspan(1)),
+                        std::invalid_argument);
+    }
+
+    TEST_CASE("checksums_detect_corrupted_values")
+    {
+        auto bytes = to_bytes(std::vector<meters_t> {meters_t {1.0}, meters_t {2.0}}, binary_checksum::crc32c);
+        CHECK_NOTHROW((void)view_binary<meters_t>(std::span<const std::byte> {bytes}));
+
+        bytes.back() ^= std::byte {1};
+        CHECK_THROWS_AS((void)view_binary<meters_t>(std::span<const std::byte> {bytes}), std::invalid_argument);
+    }
+
+    TEST_CASE("values_written_with_another_byte_order_are_swapped")
+    {
+        const auto values = std::vector<meters_t> {meters_t {1.5}, meters_t {-2.0}, meters_t {1e10}};
+        auto bytes = to_bytes(values, binary_checksum::crc32c);
+        flip_byte_order<meters_t>(bytes);
+
+        CHECK_THROWS_AS((void)view_binary<meters_t>(std::span<const std::byte> {bytes}), std::invalid_argument);
+
+        auto stream = std::stringstream {std::string(reinterpret_cast<const char*>(bytes.data()), bytes.size())};
+        CHECK(read_binary<meters_t>(stream) == values);
+
+        const auto swapped = view_binary<meters_t>(std::span<std::byte> {bytes});
+        CHECK(std::equal(swapped.begin(), swapped.end(), values.begin()));
+        // the header now records the native byte order, so the bytes can be viewed without swapping again
+        const auto view = view_binary<meters_t>(std::span<const std::byte> {bytes});
+        CHECK(std::equal(view.begin(), view.end(), values.begin()));
+    }
+}
+
+}  // namespace twig
@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "stronk/io/csv.hpp"
+
+#include <doctest/doctest.h>
+
+#include "stronk/stronk.hpp"
+#include "stronk/unit.hpp"
+#include "stronk/utilities/ratio.hpp"
+
+namespace twig
+{
+
+namespace
+{
+
+struct csv_seconds : stronk_default_unit<csv_seconds, ratio<1>>
+{
+};
+
+struct csv_euros : stronk_default_unit<csv_euros, ratio<1>>
+{
+};
+
+struct csv_order_id : stronk<csv_order_id, int64_t, can_equate>
+{
+    using stronk::stronk;
+};
+
+using seconds_t = csv_seconds::value<int64_t>;
+using euros_t = csv_euros::value<double>;
+
+}  // namespace
+
+TEST_SUITE("csv")
+{
+    TEST_CASE("selected_columns_are_parsed_into_typed_columns")
+    {
+        const auto text = std::string {
+            "time,order,price,comment\n"
+            "900, 7 ,12.5,first\r\n"
+            "1800,8,-3.25,second\n"
+            "\n"
+            "2700,9,1e3,third"};
+        const auto soa = parse_csv<seconds_t, euros_t, csv_order_id>(text, {0, 2, 1});
+
+        REQUIRE_EQ(soa.size(), 3);
+        CHECK_EQ(soa.column<seconds_t>()[2], seconds_t {2700});
+        CHECK_EQ(soa.column<euros_t>()[0], euros_t {12.5});
+        CHECK_EQ(soa.column<euros_t>()[1], euros_t {-3.25});
+        CHECK_EQ(soa.column<euros_t>()[2], euros_t {1000.0});
+        CHECK_EQ(soa.column<csv_order_id>()[0], csv_order_id {7});
+    }
+
+    TEST_CASE("chunks_parsed_in_parallel_keep_the_order_of_the_lines")
+    {
+        auto text = std::string {};
+        for (auto i = 0; i < 10000; i++) {
+            text += std::to_string(i) + ";" + std::to_string(i) + ".5\n";
+            if (i % 97 == 0) {
+                text += " \r\n";  // empty lines are not rows, so the chunks have uneven numbers of rows
+            }
+        }
+        const auto options = csv_options {.delimiter = ';', .has_header = false, .threads = 4, .min_chunk_size = 1};
+        const auto soa = parse_csv<seconds_t, euros_t>(text, {0, 1}, options);
+
+        REQUIRE_EQ(soa.size(), 10000);
+        for (auto i = std::size_t {0}; i < soa.size(); i++) {
+            REQUIRE_EQ(soa.column<seconds_t>()[i], seconds_t {static_cast<int64_t>(i)});
+            REQUIRE_EQ(soa.column<euros_t>()[i], euros_t {static_cast<double>(i) + 0.5});
+        }
+    }
+
+    TEST_CASE("errors_report_the_line")
+    {
+        auto text = std::string {"time,price\n"};
+        for (auto i = 0; i < 100; i++) {
+            text += "1,2\n";
+        }
+        const auto parse = [&text]()
+        { return parse_csv<seconds_t, euros_t>(text, {0, 1}, csv_options {.threads = 4, .min_chunk_size = 1}); };
+
+        SUBCASE("invalid_number")
+        {
+            text += "1,abc\n1,2\n";
+            CHECK_THROWS_WITH_AS((void)parse(),
+                                 "line 102: 'abc' in column 1 is not a valid number",
+                                 std::invalid_argument);
+        }
+        SUBCASE("missing_column")
+        {
+            text += "1\n1,2\n";
+            CHECK_THROWS_WITH_AS((void)parse(),
+                                 "line 102: there is no column 1",
+                                 std::invalid_argument);
+        }
+    }
+
+    TEST_CASE("columns_are_written_as_text_which_parses_to_the_same_values")
+    {
+        auto soa = stronk_soa<seconds_t, euros_t, csv_order_id> {};
+        for (auto i = int64_t {0}; i < 1000; i++) {
+            soa.push_back(seconds_t {i * 900}, euros_t {static_cast<double>(i) / 3.0}, csv_order_id {-i});
+        }
+        auto out = std::ostringstream {};
+        write_csv(out, soa, {"time", "price", "order"});
+        const auto text = out.str();
+
+        CHECK(text.starts_with("time,price,order\n0,0,0\n900,0.3333333333333333,-1\n"));
+        const auto parsed = parse_csv<seconds_t, euros_t, csv_order_id>(text, {0, 1, 2});
+        REQUIRE_EQ(parsed.size(), soa.size());
+        CHECK(std::ranges::equal(parsed.column<euros_t>(), soa.column<euros_t>()));
+        CHECK(std::ranges::equal(parsed.column<csv_order_id>(), soa.column<csv_order_id>()));
+    }
+
+    TEST_CASE("the_writer_flushes_when_its_buffer_is_full")
+    {
+        const auto times = std::vector<seconds_t>(100, seconds_t {123456});
+        const auto prices = std::vector<euros_t>(100, euros_t {-0.5});
+        auto out = std::ostringstream {};
+        {
+            auto writer = csv_writer {out, ';', 16};
+            writer.write_rows(std::span {times}, std::span {prices});
+        }
+        auto expected = std::string {};
+        for (auto i = 0; i < 100; i++) {
+            expected += "123456;-0.5\n";
+        }
+        CHECK_EQ(out.str(), expected);
+
+        auto writer = csv_writer {out};
+        CHECK_THROWS_AS(writer.write_rows(std::span {times}, std::span {prices}.first(2)), std::invalid_argument);
+    }
+
+    TEST_CASE("rows_wider_than_the_buffer_are_written_whole")
+    {
+        const auto prices = std::vector<euros_t>(10, euros_t {std::numeric_limits<double>::lowest()});
+        const auto column = std::span {prices};
+        auto out = std::ostringstream {};
+        {
+            auto writer = csv_writer {out, ',', 1};
+            writer.write_rows(column, column, column, column, column, column);
+        }
+        const auto field = std::string {"-1.7976931348623157e+308"};
+        auto expected = std::string {};
+        for (auto i = 0; i < 10; i++) {
+            expected += field + "," + field + "," + field + "," + field + "," + field + "," + field + "\n";
+        }
+        CHECK_EQ(out.str(), expected);
+    }
+
+    TEST_CASE("files_are_read")
+    {
+        const auto path = std::filesystem::temp_directory_path() / "stronk_csv_tests.csv";
+        {
+            auto out = std::ofstream {path, std::ios::binary};
+            out << "time,price\n900,1.5\n1800,2.5\n";
+        }
+        const auto read = [&path]() { return read_csv<seconds_t, euros_t>(path, {0, 1}); };
+        const auto soa = read();
+        std::filesystem::remove(path);
+
+        REQUIRE_EQ(soa.size(), 2);
+        CHECK_EQ(soa.column<euros_t>()[1], euros_t {2.5});
+        CHECK_THROWS_AS((void)read(), std::system_error);
+    }
+}
+
+}  // namespace twig
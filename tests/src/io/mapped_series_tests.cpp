@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "stronk/io/mapped_series.hpp"
+
+#include <doctest/doctest.h>
+
+#include "stronk/io/binary.hpp"
+#include "stronk/unit.hpp"
+#include "stronk/utilities/ratio.hpp"
+
+namespace twig
+{
+
+namespace
+{
+
+struct series_seconds : stronk_default_unit<series_seconds, ratio<1>>
+{
+};
+
+struct series_joules : stronk_default_unit<series_joules, ratio<1>>
+{
+};
+
+using seconds_t = series_seconds::value<int64_t>;
+using joules_t = series_joules::value<double>;
+using series_t = mapped_series<series_seconds, series_joules, double, int64_t>;
+
+// A file in the temporary directory, removed again when going out of scope
+struct temporary_file
+{
+    std::filesystem::path path;
+
+    explicit temporary_file(const std::string& name)
+        : path(std::filesystem::temp_directory_path() / ("stronk_" + name))
+    {
+    }
+
+    temporary_file(const temporary_file&) = delete;
+    temporary_file(temporary_file&&) = delete;
+    auto operator=(const temporary_file&) -> temporary_file& = delete;
+    auto operator=(temporary_file&&) -> temporary_file& = delete;
+
+    ~temporary_file()
+    {
+        auto error = std::error_code {};
+        std::filesystem::remove(this->path, error);
+    }
+};
+
+template<typename TimeT, typename ValueT>
+void write_series(const std::filesystem::path& path,
+                  const std::vector<TimeT>& times,
+                  const std::vector<ValueT>& values,
+                  binary_checksum checksum = binary_checksum::none)
+{
+    auto out = std::ofstream {path, std::ios::binary};
+    write_mapped_series(out, std::span<const TimeT> {times}, std::span<const ValueT> {values}, checksum);
+}
+
+auto make_times(std::size_t size) -> std::vector<seconds_t>
+{
+    auto times = std::vector<seconds_t> {};
+    for (auto i = std::size_t {0}; i < size; i++) {
+        times.emplace_back(static_cast<int64_t>(i) * 900);
+    }
+    return times;
+}
+
+auto make_values(std::size_t size) -> std::vector<joules_t>
+{
+    auto values = std::vector<joules_t> {};
+    for (auto i = std::size_t {0}; i < size; i++) {
+        values.emplace_back(static_cast<double>(i) * 0.25);
+    }
+    return values;
+}
+
+}  // namespace
+
+TEST_SUITE("mapped_series")
+{
+    TEST_CASE("series_are_mapped_with_the_written_times_and_values")
+    {
+        const auto file = temporary_file {"mapped_series_round_trip"};
+        // an odd number of times, so the values need padding to stay aligned
+        const auto times = make_times(1001);
+        const auto values = make_values(1001);
+        write_series(file.path, times, values, binary_checksum::crc32c);
+
+        const auto series = series_t {file.path, mapped_access::sequential};
+        REQUIRE_EQ(series.size(), values.size());
+        CHECK(std::ranges::equal(series.times(), times));
+        CHECK(std::ranges::equal(series.values(), values));
+        CHECK(series.verify_checksums());
+    }
+
+    TEST_CASE("series_can_be_moved")
+    {
+        const auto file = temporary_file {"mapped_series_move"};
+        write_series(file.path, make_times(3), make_values(3));
+
+        auto series = series_t {file.path};
+        const auto moved = std::move(series);
+        CHECK_EQ(moved.values()[2], joules_t {0.5});
+        for (auto access : {mapped_access::normal, mapped_access::random, mapped_access::will_need}) {
+            moved.advise(access);
+        }
+    }
+
+    TEST_CASE("empty_series_are_mapped")
+    {
+        const auto file = temporary_file {"mapped_series_empty"};
+        write_series(file.path, std::vector<seconds_t> {}, std::vector<joules_t> {});
+        CHECK(series_t {file.path}.empty());
+    }
+
+    TEST_CASE("series_of_other_units_are_rejected")
+    {
+        const auto file = temporary_file {"mapped_series_other_units"};
+        write_series(file.path, make_times(4), make_values(4));
+
+        using other_times_t = mapped_series<series_joules, series_joules, double, int64_t>;
+        using other_values_t = mapped_series<series_seconds, series_seconds, double, int64_t>;
+        using other_scale_t = mapped_series<series_seconds, series_joules::scaled_t<kilo>, double, int64_t>;
+        using other_underlying_t = mapped_series<series_seconds, series_joules, double>;
+        CHECK_THROWS_AS((void)other_times_t {file.path}, std::invalid_argument);
+        CHECK_THROWS_AS((void)other_values_t {file.path}, std::invalid_argument);
+        CHECK_THROWS_AS((void)other_scale_t {file.path}, std::invalid_argument);
+        CHECK_THROWS_AS((void)other_underlying_t {file.path}, std::invalid_argument);
+    }
+
+    TEST_CASE("truncated_series_are_rejected")
+    {
+        const auto file = temporary_file {"mapped_series_truncated"};
+        write_series(file.path, make_times(4), make_values(4));
+        std::filesystem::resize_file(file.path, std::filesystem::file_size(file.path) - 1);
+        CHECK_THROWS_AS((void)series_t {file.path}, std::invalid_argument);
+
+        std::filesystem::resize_file(file.path, 0);
+        CHECK_THROWS_AS((void)series_t {file.path}, std::invalid_argument);
+    }
+
+    TEST_CASE("missing_files_are_reported")
+    {
+        CHECK_THROWS_AS((void)series_t {std::filesystem::temp_directory_path() / "stronk_mapped_series_missing"},
+                        std::system_error);
+    }
+
+    TEST_CASE("series_need_a_time_for_each_value")
+    {
+        const auto file = temporary_file {"mapped_series_mismatch"};
+        CHECK_THROWS_AS(write_series(file.path, make_times(3), make_values(4)), std::invalid_argument);
+    }
+}
+
+}  // namespace twig
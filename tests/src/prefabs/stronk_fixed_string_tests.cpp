@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "stronk/prefabs/stronk_fixed_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include "stronk/stronk.hpp"
+
+namespace twig
+{
+
+struct an_eic_code : stronk_fixed_string<an_eic_code, 16>
+{
+    using stronk::stronk;
+};
+
+struct a_currency : stronk_fixed_string<a_currency, 3>
+{
+    using stronk::stronk;
+};
+
+static_assert(sizeof(an_eic_code) == 16);
+static_assert(std::is_trivially_copyable_v<an_eic_code::underlying_type>);
+#if !defined(_MSC_VER)
+// stronk writes its assignment operators by hand outside of MSVC, see stronk.hpp
+static_assert(!std::is_trivially_copyable_v<an_eic_code>);
+#endif
+static_assert(std::is_constructible_v<a_currency, const char (&)[4]>);  // NOLINT(modernize-avoid-c-arrays)
+static_assert(fixed_string {"EUR"}.size() == 3);
+static_assert(std::is_same_v<decltype(fixed_string {"EUR"}), fixed_string<3>>);
+// char arrays are read up to their first '\0', which the deduced size always has room for
+static_assert(fixed_string {"EU\0R"}.view() == "EU");
+static_assert(std::is_same_v<decltype(fixed_string {"EU\0R"}), fixed_string<4>>);
+static_assert(fixed_string<3> {"EUR"}.view() == "EUR");
+
+template<a_currency CurrencyV>
+struct a_priced_product
+{
+    constexpr static auto currency = CurrencyV;
+};
+
+TEST_SUITE("stronk_fixed_string")
+{
+    TEST_CASE("can_be_used_as_strings")
+    {
+        auto code = an_eic_code {"10YDK-1--------W"};
+        CHECK_EQ(code.size(), 16);
+        CHECK_EQ(code, an_eic_code {std::string {"10YDK-1--------W"}});
+        CHECK_NE(code, an_eic_code {"10YDK-2--------M"});
+        CHECK_EQ(code.unwrap<an_eic_code>().view(), "10YDK-1--------W");
+
+        auto short_code = an_eic_code {std::string_view {"DK1"}};
+        CHECK_EQ(short_code.size(), 3);
+        CHECK(an_eic_code {}.empty());
+
+        CHECK_THROWS_AS(an_eic_code {std::string(17, 'x')}, std::length_error);
+        const auto with_nul = std::string {"DK"} + '\0' + "1";
+        CHECK_THROWS_AS(an_eic_code {with_nul}, std::invalid_argument);
+    }
+
+    TEST_CASE("char_arrays_are_read_up_to_their_first_nul")
+    {
+        // a literal of exactly the capacity fits, one char more does not
+        CHECK_EQ(a_currency {"EUR"}.unwrap<a_currency>().view(), "EUR");
+        CHECK_EQ(a_currency {"EUR"}.size(), 3);
+        CHECK_THROWS_AS(a_currency {"EURO"}, std::length_error);
+
+        const char buffer[16] = "DKK";  // NOLINT(modernize-avoid-c-arrays)
+        CHECK_EQ(a_currency {buffer}, a_currency {"DKK"});
+        CHECK_EQ(a_currency {"DK\0K"}, a_currency {"DK"});
+
+        const char unterminated[3] = {'D', 'K', 'K'};  // NOLINT(modernize-avoid-c-arrays)
+        CHECK_THROWS_AS(a_currency {unterminated}, std::invalid_argument);
+    }
+
+    TEST_CASE("orders_like_the_texts")
+    {
+        auto currencies = std::vector<a_currency> {a_currency {"USD"}, a_currency {"DK"}, a_currency {"EUR"},
+                                                   a_currency {"DKK"}, a_currency {"\xC3\x85"}};
+        std::sort(currencies.begin(), currencies.end());
+        auto texts = std::vector<std::string_view> {};
+        for (const auto& currency : currencies) {
+            texts.push_back(currency.unwrap<a_currency>().view());
+        }
+        CHECK_EQ(texts, std::vector<std::string_view> {"DK", "DKK", "EUR", "USD", "\xC3\x85"});
+        static_assert(fixed_string<3> {"DK"} < fixed_string<3> {"DKK"});
+    }
+
+    TEST_CASE("hashes_of_equal_strings_are_equal")
+    {
+        CHECK_EQ(std::hash<a_currency> {}(a_currency {"EUR"}),
+                 std::hash<a_currency> {}(a_currency {std::string {"EUR"}}));
+        CHECK_NE(std::hash<a_currency> {}(a_currency {"EUR"}), std::hash<a_currency> {}(a_currency {"DKK"}));
+        CHECK_NE(std::hash<an_eic_code> {}(an_eic_code {"10YDK-1--------W"}),
+                 std::hash<an_eic_code> {}(an_eic_code {"10YDK-2--------M"}));
+
+        auto codes = std::unordered_set<an_eic_code> {an_eic_code {"DK1"}, an_eic_code {"DK2"}};
+        CHECK(codes.contains(an_eic_code {"DK2"}));
+        CHECK_FALSE(codes.contains(an_eic_code {"SE3"}));
+    }
+
+    TEST_CASE("can_be_used_as_a_non_type_template_parameter")
+    {
+        CHECK_EQ(a_priced_product<a_currency {"EUR"}>::currency, a_currency {"EUR"});
+        CHECK_FALSE(std::is_same_v<a_priced_product<a_currency {"EUR"}>, a_priced_product<a_currency {"DKK"}>>);
+    }
+
+    TEST_CASE("the_underlying_values_can_be_copied_as_bytes_and_viewed")
+    {
+        const auto code = an_eic_code {"10YNO-2--------T"};
+        auto copy = an_eic_code::underlying_type {};
+        std::memcpy(&copy, &code.unwrap<an_eic_code>(), sizeof(copy));
+        CHECK_EQ(an_eic_code {copy}, code);
+
+        auto func = [](an_eic_code::view_t view) -> void { CHECK_EQ(view, an_eic_code::view_t {"10YNO-2--------T"}); };
+        func(code);
+        CHECK_EQ(static_cast<an_eic_code>(static_cast<an_eic_code::view_t>(code)), code);
+    }
+}
+}  // namespace twig
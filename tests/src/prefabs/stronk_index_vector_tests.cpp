@@ -0,0 +1,134 @@
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "stronk/prefabs/stronk_index_vector.hpp"
+
+#include <doctest/doctest.h>
+
+#include "stronk/stronk.hpp"
+
+namespace twig
+{
+
+struct a_node_id : stronk<a_node_id, int32_t, can_equate>
+{
+    using stronk::stronk;
+};
+
+struct an_edge_id : stronk<an_edge_id, uint32_t, can_equate>
+{
+    using stronk::stronk;
+};
+
+struct a_small_id : stronk<a_small_id, uint8_t, can_equate>
+{
+    using stronk::stronk;
+};
+
+struct a_signed_small_id : stronk<a_signed_small_id, int8_t, can_equate>
+{
+    using stronk::stronk;
+};
+
+using node_weights_t = stronk_index_vector<a_node_id, double>;
+
+template<typename VectorT, typename IdT>
+concept indexable_by = requires(VectorT vec, IdT id) { vec[id]; };
+
+static_assert(indexable_by<node_weights_t, a_node_id>);
+static_assert(!indexable_by<node_weights_t, an_edge_id>);
+static_assert(!indexable_by<node_weights_t, std::size_t>);
+static_assert(!stronk_index_like<int32_t>);
+
+TEST_SUITE("stronk_index_vector")
+{
+    TEST_CASE("values_are_indexed_by_their_ids")
+    {
+        auto weights = node_weights_t {};
+        CHECK(weights.empty());
+        const auto first = weights.push_back(1.5);
+        const auto second = weights.push_back(2.5);
+        CHECK_EQ(first, a_node_id {0});
+        CHECK_EQ(second, a_node_id {1});
+        REQUIRE_EQ(weights.size(), 2);
+
+        weights[second] += 1.0;
+        CHECK_EQ(weights[first], 1.5);
+        CHECK_EQ(std::as_const(weights)[second], 3.5);
+        CHECK_EQ(weights.at(second), 3.5);
+        CHECK(weights.contains(second));
+        CHECK_FALSE(weights.contains(a_node_id {2}));
+        CHECK_FALSE(weights.contains(a_node_id {-1}));
+        CHECK_THROWS_AS((void)weights.at(a_node_id {2}), std::out_of_range);
+        CHECK_THROWS_AS((void)std::as_const(weights).at(a_node_id {-1}), std::out_of_range);
+    }
+
+    TEST_CASE("growing_beyond_the_ids_of_the_id_type_throws")
+    {
+        auto values = stronk_index_vector<a_small_id, int> {};
+        for (auto i = 0; i < 256; i++) {
+            CHECK_EQ(values.push_back(i), a_small_id {static_cast<uint8_t>(i)});
+        }
+        CHECK_THROWS_AS((void)values.push_back(256), std::length_error);
+        CHECK_EQ(values.size(), 256);
+        CHECK_THROWS_AS(values.resize(257), std::length_error);
+        CHECK_THROWS_AS((stronk_index_vector<a_signed_small_id, int>(129)), std::length_error);
+        CHECK_NOTHROW((stronk_index_vector<a_signed_small_id, int>(128)));
+
+        CHECK_THROWS_AS((void)id_range<a_small_id>(257), std::length_error);
+        CHECK_EQ(id_range<a_small_id>(256).back(), a_small_id {uint8_t {255}});
+    }
+
+    TEST_CASE("iterating_gives_the_ids_with_their_values")
+    {
+        auto weights = stronk_index_vector<an_edge_id, int> {3, 7};
+        for (auto [id, value] : weights) {
+            value += static_cast<int>(id.unwrap<an_edge_id>());
+        }
+        auto expected_id = an_edge_id {0U};
+        for (const auto& [id, value] : std::as_const(weights)) {
+            CHECK_EQ(id, expected_id);
+            CHECK_EQ(value, 7 + static_cast<int>(id.unwrap<an_edge_id>()));
+            expected_id = an_edge_id {expected_id.unwrap<an_edge_id>() + 1};
+        }
+        CHECK_EQ(expected_id, an_edge_id {3U});
+
+        auto ids = std::vector<an_edge_id> {};
+        for (const auto id : weights.ids()) {
+            static_assert(std::same_as<decltype(id), const an_edge_id>);
+            ids.push_back(id);
+        }
+        CHECK_EQ(ids, std::vector<an_edge_id> {an_edge_id {0U}, an_edge_id {1U}, an_edge_id {2U}});
+        CHECK_EQ(weights.values().size(), 3);
+    }
+
+    TEST_CASE("gather_reads_and_scatter_writes_the_values_of_many_ids")
+    {
+        auto weights = node_weights_t(5);
+        for (const auto id : weights.ids()) {
+            weights[id] = static_cast<double>(id.unwrap<a_node_id>()) * 10.0;
+        }
+        const auto ids = std::vector<a_node_id> {a_node_id {4}, a_node_id {0}, a_node_id {4}, a_node_id {2}};
+
+        CHECK_EQ(weights.gather(ids), std::vector<double> {40.0, 0.0, 40.0, 20.0});
+
+        const auto values = std::vector<double> {1.0, 2.0, 3.0, 4.0};
+        weights.scatter(ids, values);
+        // the last value of a repeated id is kept
+        CHECK_EQ(weights.gather(ids), std::vector<double> {3.0, 2.0, 3.0, 4.0});
+        CHECK_EQ(weights[a_node_id {1}], 10.0);
+
+        auto out = std::vector<double>(3);
+        CHECK_THROWS_AS(weights.gather(ids, std::span<double> {out}), std::invalid_argument);
+        CHECK_THROWS_AS(weights.scatter(ids, std::span<const double> {out}), std::invalid_argument);
+        // the vectorized loop assumes writing out does not change the values it reads
+        CHECK_THROWS_AS(weights.gather(ids, weights.values().subspan(1)), std::invalid_argument);
+        CHECK_EQ(weights[a_node_id {1}], 10.0);
+    }
+}
+}  // namespace twig
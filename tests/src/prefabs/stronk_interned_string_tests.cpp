@@ -0,0 +1,86 @@
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "stronk/prefabs/stronk_interned_string.hpp"
+
+#include <doctest/doctest.h>
+
+#include "stronk/stronk.hpp"
+
+namespace twig
+{
+
+struct an_area_code : stronk_interned_string<an_area_code>
+{
+    using stronk::stronk;
+};
+
+static_assert(sizeof(an_area_code) == sizeof(void*));
+static_assert(std::is_trivially_copyable_v<an_area_code::underlying_type>);
+
+TEST_SUITE("stronk_interned_string")
+{
+    TEST_CASE("equal_strings_are_interned_once")
+    {
+        const auto text = std::string {"DK1"};
+        auto area = an_area_code {"DK1"};
+        CHECK_EQ(area, an_area_code {text});
+        CHECK_NE(area, an_area_code {"DK2"});
+        CHECK_EQ(area.size(), 3);
+        CHECK_EQ(area.unwrap<an_area_code>().view().data(), an_area_code {"DK1"}.unwrap<an_area_code>().view().data());
+
+        CHECK(an_area_code {}.empty());
+        CHECK_EQ(an_area_code {}, an_area_code {""});
+    }
+
+    TEST_CASE("hashes_are_those_of_the_text")
+    {
+        CHECK_EQ(std::hash<an_area_code> {}(an_area_code {"NO2"}), crc32c_hash_policy {}(std::string_view {"NO2"}));
+        CHECK_NE(std::hash<an_area_code> {}(an_area_code {"NO2"}), std::hash<an_area_code> {}(an_area_code {"NO3"}));
+
+        auto areas = std::unordered_set<an_area_code> {an_area_code {"SE3"}, an_area_code {"SE4"}};
+        CHECK(areas.contains(an_area_code {std::string {"SE4"}}));
+        CHECK_FALSE(areas.contains(an_area_code {"SE1"}));
+    }
+
+    TEST_CASE("can_be_converted_to_string_view_and_back")
+    {
+        auto area = an_area_code {"DE"};
+        auto func = [](an_area_code::view_t view) -> void { CHECK_EQ(view, an_area_code::view_t {"DE"}); };
+        func(area);
+
+        auto and_back = static_cast<an_area_code>(static_cast<an_area_code::view_t>(area));
+        CHECK_EQ(and_back, area);
+    }
+
+    TEST_CASE("threads_interning_the_same_strings_get_the_same_pointers")
+    {
+        constexpr auto thread_count = std::size_t {4};
+        constexpr auto code_count = 500;
+        auto results = std::vector<std::vector<an_area_code>>(thread_count);
+        auto threads = std::vector<std::thread> {};
+        for (auto t = std::size_t {0}; t < thread_count; t++) {
+            threads.emplace_back(
+                [&results, t]()
+                {
+                    for (auto i = 0; i < code_count; i++) {
+                        results[t].emplace_back("code " + std::to_string(i));
+                    }
+                });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (auto t = std::size_t {1}; t < thread_count; t++) {
+            CHECK_EQ(results[t], results[0]);
+        }
+        CHECK_EQ(results[0][42].unwrap<an_area_code>().view(), "code 42");
+    }
+}
+}  // namespace twig
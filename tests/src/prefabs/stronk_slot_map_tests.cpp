@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "stronk/prefabs/stronk_slot_map.hpp"
+
+#include <doctest/doctest.h>
+
+#include "stronk/stronk.hpp"
+
+namespace twig
+{
+
+struct an_order_handle : stronk<an_order_handle, uint64_t, can_equate>
+{
+    using stronk::stronk;
+};
+
+struct a_small_handle : stronk<a_small_handle, uint8_t, can_equate>
+{
+    using stronk::stronk;
+};
+
+struct an_order
+{
+    std::string name;
+    double volume;
+};
+
+struct a_checked_order
+{
+    double volume;
+
+    explicit a_checked_order(double order_volume)
+        : volume(order_volume)
+    {
+        if (order_volume < 0.0) {
+            throw std::invalid_argument("negative volume");
+        }
+    }
+};
+
+using orders_t = stronk_slot_map<an_order_handle, an_order>;
+using small_map_t = stronk_slot_map<a_small_handle, int>;
+
+static_assert(!stronk_handle_like<uint64_t>);
+static_assert(orders_t::index_bits == 32);
+
+TEST_SUITE("stronk_slot_map")
+{
+    TEST_CASE("objects_can_be_inserted_looked_up_and_erased")
+    {
+        auto orders = orders_t {};
+        CHECK(orders.empty());
+        const auto first = orders.insert(an_order {"first", 1.0});
+        const auto second = orders.emplace("second", 2.0);
+        const auto third = orders.insert(an_order {"third", 3.0});
+        REQUIRE_EQ(orders.size(), 3);
+        CHECK_NE(first, second);
+
+        CHECK_EQ(orders[second].name, "second");
+        orders.at(third).volume += 1.0;
+        CHECK_EQ(std::as_const(orders).at(third).volume, 4.0);
+        REQUIRE_NE(orders.find(first), nullptr);
+        CHECK_EQ(orders.find(first)->name, "first");
+
+        CHECK(orders.erase(first));
+        CHECK_EQ(orders.size(), 2);
+        CHECK_FALSE(orders.contains(first));
+        CHECK_EQ(orders.find(first), nullptr);
+        CHECK_FALSE(orders.erase(first));
+        CHECK_THROWS_AS((void)orders.at(first), std::out_of_range);
+
+        // moving the last object into the erased place keeps the other handles valid
+        CHECK_EQ(orders[second].name, "second");
+        CHECK_EQ(orders[third].name, "third");
+    }
+
+    TEST_CASE("handles_to_reused_slots_are_stale")
+    {
+        auto orders = orders_t {};
+        const auto first = orders.insert(an_order {"first", 1.0});
+        orders.erase(first);
+        const auto reused = orders.insert(an_order {"reused", 2.0});
+
+        CHECK_EQ(orders_t::index_of(reused), orders_t::index_of(first));
+        CHECK_EQ(orders_t::generation_of(reused), orders_t::generation_of(first) + 1);
+        CHECK_FALSE(orders.contains(first));
+        CHECK(orders.contains(reused));
+        CHECK_FALSE(orders.contains(an_order_handle {uint64_t {0}}));
+        CHECK_FALSE(orders.contains(an_order_handle {uint64_t {12345}}));
+
+        orders.clear();
+        CHECK(orders.empty());
+        CHECK_FALSE(orders.contains(reused));
+    }
+
+    TEST_CASE("the_objects_are_stored_densely")
+    {
+        auto orders = orders_t {};
+        auto handles = std::vector<an_order_handle> {};
+        for (auto i = 0; i < 10; i++) {
+            handles.push_back(orders.insert(an_order {std::to_string(i), static_cast<double>(i)}));
+        }
+        for (auto i = std::size_t {0}; i < handles.size(); i += 2) {
+            orders.erase(handles[i]);
+        }
+        REQUIRE_EQ(orders.values().size(), 5);
+
+        auto total = 0.0;
+        for (const auto& order : orders) {
+            total += order.volume;
+        }
+        CHECK_EQ(total, 1.0 + 3.0 + 5.0 + 7.0 + 9.0);
+
+        for (auto i = std::size_t {0}; i < orders.size(); i++) {
+            CHECK_EQ(orders[orders.handle_at(i)].name, orders.values()[i].name);
+        }
+    }
+
+    TEST_CASE("generations_skip_zero_when_they_wrap")
+    {
+        auto map = small_map_t {};
+        auto handle = map.insert(1);
+        for (auto i = 0; i < 20; i++) {
+            map.erase(handle);
+            handle = map.insert(i);
+            CHECK_NE(small_map_t::generation_of(handle), 0);
+        }
+    }
+
+    TEST_CASE("running_out_of_slots_throws")
+    {
+        auto map = small_map_t {};
+        for (auto i = 0; i < 16; i++) {
+            map.insert(i);
+        }
+        CHECK_THROWS_AS(map.insert(16), std::length_error);
+        CHECK_EQ(map.size(), 16);
+    }
+
+    TEST_CASE("throwing_constructors_leave_the_map_unchanged")
+    {
+        auto map = stronk_slot_map<an_order_handle, a_checked_order> {};
+        const auto first = map.emplace(1.0);
+        CHECK_THROWS_AS(map.emplace(-1.0), std::invalid_argument);
+        CHECK_EQ(map.size(), 1);
+
+        const auto second = map.emplace(2.0);
+        CHECK_EQ(map.size(), 2);
+        CHECK_EQ(map.handle_at(0), first);
+        CHECK_EQ(map.handle_at(1), second);
+        CHECK_EQ(map.at(second).volume, 2.0);
+    }
+
+    TEST_CASE("many_inserts_take_linear_time")
+    {
+        // quadratic inserts, e.g. from reallocating on every insert, would take minutes here
+        constexpr auto count = std::size_t {1'000'000};
+        auto map = stronk_slot_map<an_order_handle, std::size_t> {};
+        auto handles = std::vector<an_order_handle> {};
+        for (auto i = std::size_t {0}; i < count; i++) {
+            handles.push_back(map.insert(i));
+        }
+        REQUIRE_EQ(map.size(), count);
+        for (auto i = std::size_t {0}; i < count; i += 9973) {
+            REQUIRE_EQ(map[handles[i]], i);
+            REQUIRE_EQ(map.handle_at(i), handles[i]);
+        }
+    }
+
+    TEST_CASE("move_only_objects_can_be_stored")
+    {
+        auto map = stronk_slot_map<an_order_handle, std::unique_ptr<int>> {};
+        const auto first = map.insert(std::make_unique<int>(1));
+        const auto second = map.insert(std::make_unique<int>(2));
+        map.erase(first);
+        CHECK_EQ(*map[second], 2);
+    }
+}
+}  // namespace twig
@@ -0,0 +1,179 @@
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "stronk/prefabs/stronk_soa.hpp"
+
+#include <doctest/doctest.h>
+
+#include "stronk/stronk.hpp"
+#include "stronk/unit.hpp"
+#include "stronk/utilities/aligned_allocator.hpp"
+#include "stronk/utilities/ratio.hpp"
+
+namespace twig
+{
+
+struct soa_euros : stronk_default_unit<soa_euros, twig::ratio<1>>
+{
+};
+
+struct soa_megawatt_hours : stronk_default_unit<soa_megawatt_hours, twig::ratio<1>>
+{
+};
+
+struct soa_seconds : stronk_default_unit<soa_seconds, twig::ratio<1>>
+{
+};
+
+using soa_price = unit_value_t<divided_unit_t<soa_euros, soa_megawatt_hours>, double>;
+using soa_volume = soa_megawatt_hours::value<double>;
+using soa_delivery_start = soa_seconds::value<int64_t>;
+
+struct soa_area_id : stronk<soa_area_id, int16_t, can_equate>
+{
+    using stronk::stronk;
+};
+
+using trades_t = stronk_soa<soa_price, soa_volume, soa_delivery_start, soa_area_id>;
+
+// A field which throws when copied, if asked to
+struct a_throwing_field
+{
+    bool throws = false;
+
+    a_throwing_field() = default;
+    explicit a_throwing_field(bool should_throw)
+        : throws(should_throw)
+    {
+    }
+    a_throwing_field(const a_throwing_field& other)
+        : throws(other.throws)
+    {
+        if (other.throws) {
+            throw std::runtime_error("copying a throwing field");
+        }
+    }
+    a_throwing_field(a_throwing_field&&) noexcept = default;
+    auto operator=(const a_throwing_field&) -> a_throwing_field& = default;
+    auto operator=(a_throwing_field&&) noexcept -> a_throwing_field& = default;
+    ~a_throwing_field() = default;
+};
+
+static_assert(std::same_as<decltype(std::declval<trades_t&>().column<soa_volume>()), std::span<soa_volume>>);
+static_assert(
+    std::same_as<decltype(std::declval<const trades_t&>().column<soa_volume>()), std::span<const soa_volume>>);
+
+TEST_SUITE("stronk_soa")
+{
+    TEST_CASE("rows_can_be_pushed_and_read_back")
+    {
+        auto trades = trades_t {};
+        trades.reserve(3);
+        CHECK(trades.empty());
+        trades.push_back(make<divided_unit_t<soa_euros, soa_megawatt_hours>>(50.0),
+                         soa_volume {2.0},
+                         soa_delivery_start {int64_t {3600}},
+                         soa_area_id {int16_t {1}});
+        trades.push_back(trades_t::value_type {
+            soa_price {60.0}, soa_volume {1.5}, soa_delivery_start {int64_t {7200}}, soa_area_id {int16_t {2}}});
+        REQUIRE_EQ(trades.size(), 2);
+
+        CHECK_EQ(trades[0].get<soa_price>(), soa_price {50.0});
+        CHECK_EQ(trades[1].get<soa_volume>(), soa_volume {1.5});
+        CHECK_EQ(trades.at(1).get<soa_area_id>(), soa_area_id {int16_t {2}});
+        CHECK_THROWS_AS((void)trades.at(2), std::out_of_range);
+
+        const auto row = static_cast<trades_t::value_type>(std::as_const(trades)[0]);
+        CHECK_EQ(std::get<soa_delivery_start>(row), soa_delivery_start {int64_t {3600}});
+    }
+
+    TEST_CASE("rows_which_fail_to_be_pushed_are_not_added")
+    {
+        auto soa = stronk_soa<soa_volume, a_throwing_field, soa_area_id> {};
+        soa.push_back(soa_volume {1.0}, a_throwing_field {}, soa_area_id {int16_t {1}});
+        CHECK_THROWS_AS(soa.push_back(soa_volume {2.0}, a_throwing_field {true}, soa_area_id {int16_t {2}}),
+                        std::runtime_error);
+        const auto throwing_row = std::tuple {soa_volume {2.0}, a_throwing_field {true}, soa_area_id {int16_t {2}}};
+        CHECK_THROWS_AS(soa.push_back(throwing_row), std::runtime_error);
+
+        CHECK_EQ(soa.size(), 1);
+        CHECK_EQ(soa.column<soa_volume>().size(), 1);
+        CHECK_EQ(soa.column<a_throwing_field>().size(), 1);
+        CHECK_EQ(soa.column<soa_area_id>().size(), 1);
+
+        soa.push_back(soa_volume {3.0}, a_throwing_field {}, soa_area_id {int16_t {3}});
+        CHECK_EQ(soa.column<soa_volume>()[1], soa_volume {3.0});
+        CHECK_EQ(soa.column<soa_area_id>()[1], soa_area_id {int16_t {3}});
+    }
+
+    TEST_CASE("rows_can_be_modified_through_the_proxy")
+    {
+        auto trades = trades_t {};
+        trades.resize(2);
+        trades[0] = trades_t::value_type {
+            soa_price {10.0}, soa_volume {1.0}, soa_delivery_start {int64_t {0}}, soa_area_id {int16_t {3}}};
+        trades[0].get<soa_volume>() = soa_volume {4.0};
+        trades[1] = trades[0];
+
+        CHECK_EQ(trades[1].get<soa_price>(), soa_price {10.0});
+        CHECK_EQ(trades[1].get<soa_volume>(), soa_volume {4.0});
+        CHECK_EQ(trades[1].get<soa_area_id>(), soa_area_id {int16_t {3}});
+    }
+
+    TEST_CASE("columns_are_contiguous_aligned_and_typed")
+    {
+        auto trades = trades_t {};
+        for (auto i = 0; i < 100; i++) {
+            trades.push_back(soa_price {static_cast<double>(i)},
+                             soa_volume {2.0},
+                             soa_delivery_start {int64_t {i}},
+                             soa_area_id {static_cast<int16_t>(i % 3)});
+        }
+
+        auto volumes = trades.column<soa_volume>();
+        REQUIRE_EQ(volumes.size(), 100);
+        const auto address = reinterpret_cast<std::uintptr_t>(volumes.data());  // NOLINT
+        CHECK_EQ(address % stronk_details::simd_alignment, 0);
+
+        for (auto& volume : volumes) {
+            volume = volume * 2.0;
+        }
+
+        using euros_t = unit_value_t<soa_euros, double>;
+        auto total = euros_t {0.0};
+        const auto prices = std::as_const(trades).column<soa_price>();
+        for (auto i = std::size_t {0}; i < prices.size(); i++) {
+            total += prices[i] * volumes[i];
+        }
+        CHECK_EQ(total, euros_t {4.0 * 99.0 * 100.0 / 2.0});
+    }
+
+    TEST_CASE("rows_can_be_iterated")
+    {
+        auto trades = trades_t {};
+        trades.push_back(
+            soa_price {1.0}, soa_volume {1.0}, soa_delivery_start {int64_t {0}}, soa_area_id {int16_t {0}});
+        trades.push_back(
+            soa_price {2.0}, soa_volume {1.0}, soa_delivery_start {int64_t {0}}, soa_area_id {int16_t {1}});
+
+        auto count = 0;
+        for (auto row : trades) {
+            row.get<soa_area_id>() = soa_area_id {int16_t {7}};
+            count++;
+        }
+        CHECK_EQ(count, 2);
+        for (const auto row : std::as_const(trades)) {
+            CHECK_EQ(row.get<soa_area_id>(), soa_area_id {int16_t {7}});
+        }
+
+        trades.clear();
+        CHECK(trades.empty());
+    }
+}
+
+}  // namespace twig
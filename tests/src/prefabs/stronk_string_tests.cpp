@@ -1,9 +1,15 @@
-
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "stronk/prefabs/stronk_string.hpp"
 
 #include <doctest/doctest.h>
 
+#include "stronk/skills/can_hash.hpp"
+#include "stronk/skills/can_view.hpp"
 #include "stronk/stronk.hpp"
 
 namespace twig
@@ -14,6 +20,18 @@ struct a_string_type : stronk_string<a_string_type>
     using stronk::stronk;
 };
 
+struct a_string_type_without_equality
+    : stronk<a_string_type_without_equality, std::string, can_be_const_viewed_as<std::string_view>::skill>
+{
+    using stronk::stronk;
+};
+
+template<typename T>
+concept has_transparent_equal_to = requires { typename std::equal_to<T>::is_transparent; };
+
+static_assert(has_transparent_equal_to<a_string_type>);
+static_assert(!has_transparent_equal_to<a_string_type_without_equality>);
+
 TEST_SUITE("stronk_string")
 {
     TEST_CASE("can be used as strings")
@@ -33,5 +51,29 @@ TEST_SUITE("stronk_string")
         auto and_back = static_cast<a_string_type>(static_cast<a_string_type::view_t>(stronk_string));
         CHECK_EQ(and_back, a_string_type {"hello"});
     }
+
+    TEST_CASE("hash_containers_can_look_up_by_views")
+    {
+        auto positions = std::unordered_map<a_string_type, int> {
+            {a_string_type {"DK1"}, 1},
+            {a_string_type {"DK2"}, 2},
+        };
+        const auto message = std::string {"area=DK2;"};
+        const auto area = std::string_view {message}.substr(5, 3);
+
+        REQUIRE(positions.find(area) != positions.end());
+        CHECK_EQ(positions.find(area)->second, 2);
+        CHECK_EQ(positions.find(a_string_type::view_t {"DK1"})->second, 1);
+        CHECK(positions.contains("DK1"));
+        CHECK_FALSE(positions.contains(std::string_view {"SE3"}));
+
+        auto areas = std::unordered_set<a_string_type> {a_string_type {"NO2"}};
+        CHECK_EQ(areas.count(std::string_view {"NO2"}), 1);
+
+        CHECK_EQ(std::hash<a_string_type> {}(a_string_type {"DK1"}), std::hash<std::string_view> {}("DK1"));
+        CHECK(std::equal_to<a_string_type> {}(a_string_type {"DK1"}, std::string_view {"DK1"}));
+        CHECK(std::equal_to<a_string_type> {}(a_string_type::view_t {"DK1"}, a_string_type {"DK1"}));
+        CHECK_FALSE(std::equal_to<a_string_type> {}(a_string_type {"DK1"}, a_string_type {"DK2"}));
+    }
 }
 }  // namespace twig
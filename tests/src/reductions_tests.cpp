@@ -0,0 +1,143 @@
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "stronk/reductions.hpp"
+
+#include <doctest/doctest.h>
+
+#include "stronk/unit.hpp"
+#include "stronk/unit_vector.hpp"
+#include "stronk/utilities/ratio.hpp"
+
+namespace twig
+{
+
+struct red_euros : stronk_default_unit<red_euros, twig::ratio<1>>
+{
+};
+
+struct red_megawatt_hours : stronk_default_unit<red_megawatt_hours, twig::ratio<1>>
+{
+};
+
+using red_price_unit = divided_unit_t<red_euros, red_megawatt_hours>;
+using red_euros_t = red_euros::value<double>;
+using red_volume_t = red_megawatt_hours::value<double>;
+using red_price_t = unit_value_t<red_price_unit, double>;
+
+static_assert(unit_value_range<std::vector<red_volume_t>>);
+static_assert(unit_value_range<std::span<const red_volume_t>>);
+static_assert(unit_value_range<unit_vector<red_megawatt_hours, double>>);
+static_assert(unit_value_range<std::vector<double>>);
+static_assert(!unit_value_range<std::vector<std::vector<double>>>);
+
+namespace
+{
+
+auto make_volumes(std::size_t size) -> std::vector<red_volume_t>
+{
+    auto volumes = std::vector<red_volume_t>();
+    volumes.reserve(size);
+    for (auto i = std::size_t {0}; i < size; i++) {
+        volumes.emplace_back(static_cast<double>(i % 10));
+    }
+    return volumes;
+}
+
+}  // namespace
+
+TEST_SUITE("reductions")
+{
+    TEST_CASE("sum_and_mean_keep_the_unit")
+    {
+        // sizes around the number of lanes to cover the tails
+        for (auto size : std::array<std::size_t, 6> {1, 7, 8, 9, 100, 1001}) {
+            const auto volumes = make_volumes(size);
+            auto expected = 0.0;
+            for (const auto& volume : volumes) {
+                expected += volume.unwrap<red_volume_t>();
+            }
+
+            static_assert(std::same_as<decltype(twig::sum(volumes)), red_volume_t>);
+            CHECK_EQ(twig::sum(volumes), red_volume_t {expected});
+            CHECK_EQ(twig::sum(volumes, pairwise_summation {}), red_volume_t {expected});
+            CHECK_EQ(twig::mean(volumes), red_volume_t {expected / static_cast<double>(size)});
+        }
+
+        CHECK_EQ(twig::sum(std::vector<red_volume_t> {}), red_volume_t {0.0});
+        CHECK_THROWS_AS((void)twig::mean(std::vector<red_volume_t> {}), std::invalid_argument);
+    }
+
+    TEST_CASE("pairwise_summation_is_more_accurate_for_long_series")
+    {
+        auto values = std::vector<float>(1 << 20, 0.1F);
+        const auto expected = 0.1 * static_cast<double>(values.size());
+
+        const auto lanes_error = std::abs(static_cast<double>(twig::sum(values)) - expected);
+        const auto pairwise_error = std::abs(static_cast<double>(twig::sum(values, pairwise_summation {})) - expected);
+        CHECK_LT(pairwise_error, lanes_error);
+        CHECK_LT(pairwise_error, expected * 1e-6);
+    }
+
+    TEST_CASE("min_max_and_their_indices")
+    {
+        auto volumes = make_volumes(37);
+        volumes[13] = red_volume_t {-4.0};
+        volumes[21] = red_volume_t {-4.0};
+        volumes[30] = red_volume_t {42.0};
+
+        CHECK_EQ(twig::min(volumes), red_volume_t {-4.0});
+        CHECK_EQ(twig::max(volumes), red_volume_t {42.0});
+        CHECK_EQ(twig::argmin(volumes), 13);
+        CHECK_EQ(twig::argmax(volumes), 30);
+
+        const auto single = std::vector<red_volume_t> {red_volume_t {1.0}};
+        CHECK_EQ(twig::argmin(single), 0);
+        CHECK_EQ(twig::max(single), red_volume_t {1.0});
+
+        CHECK_THROWS_AS((void)twig::min(std::vector<red_volume_t> {}), std::invalid_argument);
+        CHECK_THROWS_AS((void)twig::argmax(std::vector<red_volume_t> {}), std::invalid_argument);
+    }
+
+    TEST_CASE("integer_reductions")
+    {
+        const auto values = std::vector<int64_t> {5, -3, 12, 7, 7, 0, 12, 1, 2, 3};
+        CHECK_EQ(twig::sum(values), 46);
+        CHECK_EQ(twig::min(values), -3);
+        CHECK_EQ(twig::max(values), 12);
+        CHECK_EQ(twig::argmax(values), 2);
+    }
+
+    TEST_CASE("dot_gives_the_multiplied_unit")
+    {
+        const auto prices = std::vector<red_price_t> {red_price_t {50.0}, red_price_t {60.0}, red_price_t {-10.0}};
+        const auto volumes = std::vector<red_volume_t> {red_volume_t {2.0}, red_volume_t {1.5}, red_volume_t {3.0}};
+
+        const auto cost = twig::dot(prices, volumes);
+        static_assert(std::same_as<decltype(cost), const red_euros_t>);
+        CHECK_EQ(cost, red_euros_t {160.0});
+        CHECK_EQ(twig::dot(prices, volumes, pairwise_summation {}), red_euros_t {160.0});
+
+        CHECK_THROWS_AS((void)twig::dot(prices, std::vector<red_volume_t> {}), std::invalid_argument);
+    }
+
+    TEST_CASE("unit_vectors_and_spans_can_be_reduced")
+    {
+        auto volumes = unit_vector<red_megawatt_hours, double>(20, red_volume_t {1.5});
+        volumes[4] = red_volume_t {-1.0};
+        CHECK_EQ(twig::sum(volumes), red_volume_t {27.5});
+        CHECK_EQ(twig::argmin(volumes), 4);
+
+        const auto prices = std::vector<red_price_t>(20, red_price_t {2.0});
+        CHECK_EQ(twig::dot(volumes, std::span {prices}), red_euros_t {55.0});
+        CHECK_EQ(twig::dot(evaluate(volumes * 2.0), prices), red_euros_t {110.0});
+    }
+}
+
+}  // namespace twig
@@ -1,5 +1,12 @@
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 #include "stronk/skills/can_hash.hpp"  // IWYU pragma: keep to keep the overload
 
@@ -15,6 +22,38 @@ struct a_hashable_type : stronk<a_hashable_type, int64_t>
     using stronk::stronk;
 };
 
+struct a_mix_hashed_id : stronk<a_mix_hashed_id, int64_t, can_equate, can_hash_with<mix_hash_policy>::skill>
+{
+    using stronk::stronk;
+};
+
+struct a_crc_hashed_id : stronk<a_crc_hashed_id, int64_t, can_equate, can_hash_with<crc32c_hash_policy>::skill>
+{
+    using stronk::stronk;
+};
+
+struct a_crc_hashed_name
+    : stronk<a_crc_hashed_name, std::string, can_equate, can_hash_with<crc32c_hash_policy>::skill>
+{
+    using stronk::stronk;
+};
+
+namespace
+{
+
+// The number of the buckets hit by the lowest 8 bits of the hashes of 256 sequential ids
+template<typename HashT>
+auto buckets_hit_by_sequential_ids() -> std::size_t
+{
+    auto buckets = std::set<std::size_t> {};
+    for (auto i = int64_t {0}; i < 256; i++) {
+        buckets.insert((HashT {}(i * 256)) & 0xFFU);
+    }
+    return buckets.size();
+}
+
+}  // namespace
+
 TEST_SUITE("can_hash")
 {
     TEST_CASE("can_hash_overloads_std_hash")
@@ -25,5 +64,81 @@ TEST_SUITE("can_hash")
             CHECK_EQ(hash, expected_val);
         }
     }
+
+    TEST_CASE("the_hash_policy_skill_selects_the_hash_of_std_hash")
+    {
+        for (auto i = -10; i < 10; i++) {
+            CHECK_EQ(std::hash<a_mix_hashed_id> {}(a_mix_hashed_id {i}), mix_hash_policy {}(int64_t {i}));
+            CHECK_EQ(std::hash<a_crc_hashed_id> {}(a_crc_hashed_id {i}), crc32c_hash_policy {}(int64_t {i}));
+        }
+        CHECK_EQ(std::hash<a_crc_hashed_name> {}(a_crc_hashed_name {"DK1"}),
+                 crc32c_hash_policy {}(std::string {"DK1"}));
+        CHECK_NE(std::hash<a_crc_hashed_name> {}(a_crc_hashed_name {"DK1"}),
+                 std::hash<a_crc_hashed_name> {}(a_crc_hashed_name {"DK2"}));
+
+        auto ids = std::unordered_set<a_mix_hashed_id> {};
+        for (auto i = 0; i < 1000; i++) {
+            ids.insert(a_mix_hashed_id {i});
+        }
+        CHECK_EQ(ids.size(), 1000);
+        CHECK(ids.contains(a_mix_hashed_id {999}));
+    }
+
+    TEST_CASE("mixing_policies_spread_sequential_ids_over_the_low_bits")
+    {
+        // std::hash is the identity for integers in libstdc++, so all these ids would share one bucket there
+        CHECK_GT(buckets_hit_by_sequential_ids<mix_hash_policy>(), 128);
+        CHECK_GT(buckets_hit_by_sequential_ids<crc32c_hash_policy>(), 128);
+    }
+
+    TEST_CASE("equal_values_have_equal_hashes")
+    {
+        CHECK_EQ(mix_hash_policy {}(0.0), mix_hash_policy {}(-0.0));
+        CHECK_EQ(crc32c_hash_policy {}(0.0), crc32c_hash_policy {}(-0.0));
+        CHECK_NE(mix_hash_policy {}(1.0), mix_hash_policy {}(2.0));
+        CHECK_NE(mix_hash_policy {}(1.0F), mix_hash_policy {}(-1.0F));
+    }
+
+    TEST_CASE("hash_span_hashes_every_key_like_std_hash_by_default")
+    {
+        auto keys = std::vector<a_mix_hashed_id> {};
+        auto plain_keys = std::vector<a_hashable_type> {};
+        auto names = std::vector<a_crc_hashed_name> {a_crc_hashed_name {"DK1"}, a_crc_hashed_name {"SE3"}};
+        for (auto i = 0; i < 100; i++) {
+            keys.emplace_back(i * 7);
+            plain_keys.emplace_back(i * 7);
+        }
+        auto hashes = std::vector<std::size_t>(keys.size());
+
+        hash_span(std::span<const a_mix_hashed_id> {keys}, std::span<std::size_t> {hashes});
+        for (auto i = std::size_t {0}; i < keys.size(); i++) {
+            CHECK_EQ(hashes[i], std::hash<a_mix_hashed_id> {}(keys[i]));
+        }
+        hash_span(std::span<const a_hashable_type> {plain_keys}, std::span<std::size_t> {hashes});
+        for (auto i = std::size_t {0}; i < plain_keys.size(); i++) {
+            CHECK_EQ(hashes[i], std::hash<a_hashable_type> {}(plain_keys[i]));
+        }
+        hash_span(std::span<const a_crc_hashed_name> {names}, std::span<std::size_t> {hashes}.first(2));
+        CHECK_EQ(hashes[0], std::hash<a_crc_hashed_name> {}(names[0]));
+        CHECK_EQ(hashes[1], std::hash<a_crc_hashed_name> {}(names[1]));
+
+        hash_span<crc32c_hash_policy>(std::span<const a_mix_hashed_id> {keys}, std::span<std::size_t> {hashes});
+        CHECK_EQ(hashes[3], crc32c_hash_policy {}(int64_t {21}));
+
+        CHECK_THROWS_AS(hash_span(std::span<const a_mix_hashed_id> {keys}, std::span<std::size_t> {hashes}.first(3)),
+                        std::invalid_argument);
+    }
+
+    TEST_CASE("combined_hashes_depend_on_every_value_and_their_order")
+    {
+        const auto hash = combined_hash(a_mix_hashed_id {1}, a_crc_hashed_id {2}, 3.5);
+        CHECK_NE(hash, combined_hash(int64_t {1}, int64_t {2}, 3.5));  // each value is hashed with its own policy
+        CHECK_EQ(combined_hash<mix_hash_policy>(a_mix_hashed_id {1}, a_crc_hashed_id {2}, 3.5),
+                 combined_hash<mix_hash_policy>(int64_t {1}, int64_t {2}, 3.5));
+        CHECK_NE(hash, combined_hash(a_mix_hashed_id {2}, a_crc_hashed_id {1}, 3.5));
+        CHECK_NE(hash, combined_hash(a_mix_hashed_id {1}, a_crc_hashed_id {2}, 4.5));
+        CHECK_NE(combined_hash<crc32c_hash_policy>(int64_t {1}, int64_t {2}),
+                 combined_hash<crc32c_hash_policy>(int64_t {2}, int64_t {1}));
+    }
 }
 }  // namespace twig
@@ -0,0 +1,56 @@
+#include <cstdint>
+#include <stdexcept>
+
+#include "stronk/skills/can_parse.hpp"
+
+#include <doctest/doctest.h>
+
+#include "stronk/stronk.hpp"
+#include "stronk/unit.hpp"
+#include "stronk/utilities/ratio.hpp"
+
+namespace twig
+{
+
+struct a_parsable_type : stronk<a_parsable_type, int16_t, can_parse, can_equate>
+{
+    using stronk::stronk;
+};
+
+struct a_parsable_unit : stronk_default_unit<a_parsable_unit, ratio<1>>
+{
+};
+
+static_assert(parsable<a_parsable_type>);
+static_assert(parsable<a_parsable_unit::value<double>>);
+static_assert(parsable<uint64_t>);
+static_assert(!parsable<bool>);
+
+TEST_SUITE("can_parse")
+{
+    TEST_CASE("parsing_gives_the_value_of_the_text")
+    {
+        CHECK_EQ(a_parsable_type::parse("-42"), a_parsable_type {int16_t {-42}});
+        CHECK_EQ(parse<a_parsable_unit::value<double>>("1.5e3"), a_parsable_unit::value<double> {1500.0});
+        CHECK_EQ(parse<a_parsable_unit::value<float>>("0.25"), a_parsable_unit::value<float> {0.25F});
+        CHECK_EQ(parse<uint64_t>("18446744073709551615"), UINT64_MAX);
+    }
+
+    TEST_CASE("text_which_is_not_a_number_is_rejected")
+    {
+        CHECK_THROWS_AS((void)a_parsable_type::parse(""), std::invalid_argument);
+        CHECK_THROWS_AS((void)a_parsable_type::parse("abc"), std::invalid_argument);
+        CHECK_THROWS_AS((void)a_parsable_type::parse("12abc"), std::invalid_argument);
+        CHECK_THROWS_AS((void)a_parsable_type::parse(" 12"), std::invalid_argument);
+        CHECK_THROWS_AS((void)a_parsable_type::parse("1.5"), std::invalid_argument);
+    }
+
+    TEST_CASE("numbers_which_do_not_fit_are_out_of_range")
+    {
+        CHECK_THROWS_AS((void)a_parsable_type::parse("40000"), std::out_of_range);
+        CHECK_THROWS_AS((void)parse<uint64_t>("-1"), std::invalid_argument);
+        CHECK_THROWS_AS((void)parse<float>("1e100"), std::out_of_range);
+    }
+}
+
+}  // namespace twig
@@ -0,0 +1,108 @@
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "stronk/unit_conversion.hpp"
+
+#include <doctest/doctest.h>
+
+#include "stronk/unit.hpp"
+#include "stronk/utilities/ratio.hpp"
+
+namespace twig
+{
+
+struct conv_watt_hours : stronk_default_unit<conv_watt_hours, twig::ratio<1>>
+{
+};
+
+using conv_kilo_watt_hours = conv_watt_hours::scaled_t<twig::kilo>;
+using conv_mega_watt_hours = conv_watt_hours::scaled_t<twig::mega>;
+
+struct conv_seconds : stronk_default_unit<conv_seconds, twig::ratio<1>>
+{
+};
+
+template<typename ToUnitT, typename InT, typename OutT>
+concept can_convert = requires(const InT& in, OutT& out) { twig::convert<ToUnitT>(in, out); };
+
+static_assert(can_convert<conv_mega_watt_hours,
+                          std::vector<conv_kilo_watt_hours::value<double>>,
+                          std::vector<conv_mega_watt_hours::value<double>>>);
+// the output must be exactly the converted type
+static_assert(!can_convert<conv_mega_watt_hours,
+                           std::vector<conv_kilo_watt_hours::value<double>>,
+                           std::vector<conv_mega_watt_hours::value<float>>>);
+// and only scales can be converted, not dimensions
+static_assert(!can_convert<conv_seconds,
+                           std::vector<conv_kilo_watt_hours::value<double>>,
+                           std::vector<conv_seconds::value<double>>>);
+
+TEST_SUITE("convert")
+{
+    TEST_CASE("converting_floating_points_multiplies_by_the_folded_factor")
+    {
+        using converter =
+            stronk_details::scale_converter<kilo, mega, double, stronk_details::bulk_scale_folding_policy>;
+        static_assert(converter::is_folded());
+        static_assert(!converter::factor_is_exact());
+
+        auto quarter_hours = std::vector<conv_kilo_watt_hours::value<double>>();
+        for (auto i = 0; i < 96; i++) {
+            quarter_hours.emplace_back(static_cast<double>(i) * 12.5);
+        }
+
+        using mwh_t = conv_mega_watt_hours::value<double>;
+        auto mwh = std::vector<mwh_t>(quarter_hours.size());
+        twig::convert<conv_mega_watt_hours>(quarter_hours, mwh);
+        auto differs_from_to = false;
+        for (auto i = std::size_t {0}; i < mwh.size(); i++) {
+            const auto kwh = quarter_hours[i].unwrap<conv_kilo_watt_hours::value<double>>();
+            const auto converted = mwh[i].unwrap<mwh_t>();
+            CHECK_EQ(converted, kwh * converter::factor());
+            // the folded factor 0.001 is not exact, so the results are within 1 ULP of to<>()'s divide by 1000
+            const auto exact = quarter_hours[i].to<conv_mega_watt_hours>().unwrap<mwh_t>();
+            CHECK_LE(std::abs(converted - exact), std::abs(exact) * std::numeric_limits<double>::epsilon());
+            differs_from_to = differs_from_to || converted != exact;
+        }
+        CHECK(differs_from_to);
+
+        const auto back = twig::convert<conv_kilo_watt_hours>(std::span {mwh});
+        REQUIRE_EQ(back.size(), quarter_hours.size());
+        CHECK_EQ(back[95], quarter_hours[95]);
+    }
+
+    TEST_CASE("converting_integers_is_exact")
+    {
+        const auto kwh = std::vector<conv_kilo_watt_hours::value<int32_t>> {
+            conv_kilo_watt_hours::value<int32_t> {1999}, conv_kilo_watt_hours::value<int32_t> {-1999}};
+
+        const auto mwh = twig::convert<conv_mega_watt_hours>(kwh);
+        CHECK_EQ(mwh[0], conv_mega_watt_hours::value<int32_t> {1});
+        CHECK_EQ(mwh[1], conv_mega_watt_hours::value<int32_t> {-1});
+
+        const auto wh = twig::convert<conv_watt_hours>(kwh);
+        CHECK_EQ(wh[0], conv_watt_hours::value<int32_t> {1999000});
+        CHECK_EQ(wh[1], conv_watt_hours::value<int32_t> {-1999000});
+    }
+
+    TEST_CASE("converting_integers_detects_overflow")
+    {
+        const auto kwh = std::vector<conv_kilo_watt_hours::value<int32_t>> {
+            conv_kilo_watt_hours::value<int32_t> {1},
+            conv_kilo_watt_hours::value<int32_t> {std::numeric_limits<int32_t>::max() / 1000 + 1}};
+        CHECK_THROWS_AS((void)twig::convert<conv_watt_hours>(kwh), std::overflow_error);
+    }
+
+    TEST_CASE("mismatching_sizes_throws")
+    {
+        const auto kwh = std::vector<conv_kilo_watt_hours::value<double>>(3);
+        auto mwh = std::vector<conv_mega_watt_hours::value<double>>(2);
+        CHECK_THROWS_AS(twig::convert<conv_mega_watt_hours>(kwh, mwh), std::invalid_argument);
+    }
+}
+
+}  // namespace twig
@@ -0,0 +1,78 @@
+#include <string_view>
+
+#include "stronk/unit_symbol.hpp"
+
+#include <doctest/doctest.h>
+
+#include "stronk/unit.hpp"
+#include "stronk/utilities/ratio.hpp"
+
+namespace twig
+{
+
+namespace
+{
+
+struct symbol_watt_hours : stronk_default_unit<symbol_watt_hours, ratio<1>>
+{
+    constexpr static std::string_view symbol = "Wh";
+};
+
+struct symbol_meters : stronk_default_unit<symbol_meters, ratio<1>>
+{
+    constexpr static std::string_view symbol = "m";
+};
+
+struct symbol_seconds : stronk_default_unit<symbol_seconds, ratio<1>>
+{
+    constexpr static std::string_view symbol = "s";
+};
+
+struct symbol_euros : stronk_default_unit<symbol_euros, ratio<1>>
+{
+    constexpr static std::string_view symbol = "EUR";
+    constexpr static bool si_prefixable = false;
+};
+
+struct symbol_less_unit : stronk_default_unit<symbol_less_unit, ratio<1>>
+{
+};
+
+using mega_watt_hours = symbol_watt_hours::scaled_t<mega>;
+using euros_per_mega_watt_hour = divided_unit_t<symbol_euros, mega_watt_hours>;
+using hours = symbol_seconds::scaled_t<ratio<3600>>;
+
+}  // namespace
+
+template<>
+struct unit_symbol<hours>
+{
+    constexpr static std::string_view value = "h";
+};
+
+static_assert(unit_symbol_v<symbol_watt_hours> == "Wh");
+static_assert(unit_symbol_v<mega_watt_hours> == "MWh");
+static_assert(unit_symbol_v<symbol_meters::scaled_t<milli>> == "mm");
+static_assert(unit_symbol_v<symbol_meters::scaled_t<micro>> == "\xC2\xB5m");
+static_assert(unit_symbol_v<euros_per_mega_watt_hour> == "EUR/MWh");
+static_assert(unit_symbol_v<divided_unit_t<symbol_meters, symbol_seconds>> == "m/s");
+static_assert(unit_symbol_v<divided_unit_t<symbol_meters, multiplied_unit_t<symbol_seconds, symbol_seconds>>>
+              == "m/s^2");
+static_assert(unit_symbol_v<multiplied_unit_t<symbol_meters, symbol_meters>::scaled_t<mega>> == "km^2");
+static_assert(unit_symbol_v<divided_unit_t<identity_unit, symbol_seconds>> == "1/s");
+static_assert(unit_symbol_v<divided_unit_t<symbol_euros, multiplied_unit_t<symbol_meters, symbol_seconds>>>
+              == "EUR/(m*s)");
+// the order of the units does not depend on the order they were multiplied in
+static_assert(unit_symbol_v<multiplied_unit_t<symbol_meters, symbol_euros>>
+              == unit_symbol_v<multiplied_unit_t<symbol_euros, symbol_meters>>);
+// scales which are not SI prefixes of any of the units are written in brackets
+static_assert(unit_symbol_v<symbol_euros::scaled_t<kilo>> == "[1000]EUR");
+static_assert(unit_symbol_v<symbol_meters::scaled_t<ratio<1, 4>>> == "[1/4]m");
+static_assert(unit_symbol_v<hours> == "h");
+
+static_assert(has_unit_symbol<symbol_watt_hours>);
+static_assert(!has_unit_symbol<symbol_less_unit>);
+static_assert(!has_unit_symbol<multiplied_unit_t<symbol_less_unit, symbol_watt_hours>>);
+static_assert(!has_unit_symbol<identity_unit>);
+
+}  // namespace twig
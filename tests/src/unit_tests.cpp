@@ -16,6 +16,7 @@
 #endif
 #include "stronk/extensions/gtest.hpp"  // IWYU pragma: keep for printing values in assertions
 #include "stronk/utilities/dimensions.hpp"
+#include "stronk/utilities/scale_conversion.hpp"
 
 namespace twig
 {
@@ -66,6 +67,24 @@ static_assert(unit_value_like<unit_value_t<acceleration_m_per_s2, int32_t>>);
 static_assert(!unit_value_like<a_regular_stronk_type>);
 static_assert(!unit_value_like<a_regular_type>);
 
+// Testing the common scales
+static_assert(std::same_as<ratio_common<twig::kilo, twig::mega>, twig::kilo>);
+static_assert(std::same_as<ratio_common<twig::milli, twig::kilo>, twig::milli>);
+static_assert(std::same_as<ratio_common<twig::ratio<1, 3>, twig::ratio<1, 2>>, twig::ratio<1, 6>>);
+static_assert(std::same_as<ratio_common<twig::ratio<2, 3>, twig::ratio<3, 4>>, twig::ratio<1, 12>>);
+
+struct watts : stronk_default_unit<watts, twig::ratio<1>>
+{
+};
+
+static_assert(unit_values_of_different_scales<unit_scaled_value_t<twig::kilo, watts, int64_t>,
+                                              unit_scaled_value_t<twig::mega, watts, int64_t>>);
+static_assert(!unit_values_of_different_scales<unit_value_t<watts, int64_t>, unit_value_t<watts, int64_t>>);
+static_assert(!unit_values_of_different_scales<unit_value_t<watts, int64_t>,  // different underlying types
+                                               unit_scaled_value_t<twig::kilo, watts, double>>);
+static_assert(!unit_values_of_different_scales<unit_value_t<watts, double>,  // different units
+                                               unit_scaled_value_t<twig::kilo, meters, double>>);
+
 // Testing the generated types
 
 // clang-format off
@@ -422,6 +441,55 @@ TEST_SUITE("unit")
         CHECK_EQ(converted_to_km_per_hr, expected_km_per_hr);
     }
 
+    TEST_CASE("conversions_fold_the_scale_ratio")
+    {
+        using km_t = meters::scaled_t<twig::kilo>;
+
+        // floating points multiply by exact factors, and keep the correctly rounded divide for inexact ones
+        CHECK_EQ(make<km_t>(1.5).to<meters>().unwrap<meters::value<double>>(), 1500.0);
+        CHECK_EQ(make<meters>(1500.0).to<km_t>().unwrap<km_t::value<double>>(), 1.5);
+
+        // integers are exact without dividing when scaling up, and truncate when scaling down
+        auto m_int = make<km_t>(int64_t {3}).to<meters>();
+        CHECK_EQ(m_int.unwrap<decltype(m_int)>(), 3000);
+        CHECK_EQ(make<meters>(int64_t {-3999}).to<km_t>().unwrap<km_t::value<int64_t>>(), -3);
+
+        // scaled identity values keep the ratio in the type, and are converted back through the same folding
+        auto scaled = identity_value_t<twig::kilo, double> {1.0} * make<meters>(5.0);
+        static_assert(std::same_as<decltype(scaled), km_t::value<double>>);
+        CHECK_EQ(scaled.to<meters>(), make<meters>(5000.0));
+    }
+
+    TEST_CASE("values_of_different_scales_are_promoted_to_their_common_scale")
+    {
+        using kilo_watts_t = unit_scaled_value_t<twig::kilo, watts, int64_t>;
+        using mega_watts_t = unit_scaled_value_t<twig::mega, watts, int64_t>;
+
+        // only the mega watts are scaled, as kilo is the common scale
+        static_assert(std::same_as<decltype(kilo_watts_t {1} + mega_watts_t {1}), kilo_watts_t>);
+        static_assert(std::same_as<decltype(mega_watts_t {1} - kilo_watts_t {1}), kilo_watts_t>);
+        CHECK_EQ(kilo_watts_t {250} + mega_watts_t {2}, kilo_watts_t {2'250});
+        CHECK_EQ(mega_watts_t {2} - kilo_watts_t {250}, kilo_watts_t {1'750});
+
+        CHECK_EQ(mega_watts_t {3}, kilo_watts_t {3'000});
+        CHECK_NE(mega_watts_t {3}, kilo_watts_t {3'001});
+        CHECK_LT(kilo_watts_t {999}, mega_watts_t {1});
+        CHECK_GT(mega_watts_t {1}, kilo_watts_t {999});
+        CHECK_LE(mega_watts_t {1}, kilo_watts_t {1'000});
+
+        // scales which are not multiples of each other are both converted
+        using third_watts_t = unit_scaled_value_t<twig::ratio<1, 3>, watts, int64_t>;
+        using half_watts_t = unit_scaled_value_t<twig::ratio<1, 2>, watts, int64_t>;
+        using sixth_watts_t = unit_scaled_value_t<twig::ratio<1, 6>, watts, int64_t>;
+        static_assert(std::same_as<decltype(third_watts_t {1} + half_watts_t {1}), sixth_watts_t>);
+        CHECK_EQ(third_watts_t {1} + half_watts_t {1}, sixth_watts_t {5});
+        CHECK_EQ(third_watts_t {3}, half_watts_t {2});
+
+        using km_t = meters::scaled_t<twig::kilo>;
+        CHECK_EQ(make<km_t>(1.5) + make<meters>(250.0), make<meters>(1750.0));
+        CHECK_EQ(make<km_t>(1.75), make<meters>(1750.0));
+    }
+
     TEST_CASE("values can be in constexpr")
     {
         constexpr auto val = make<meters, int>(1);
@@ -0,0 +1,236 @@
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "stronk/unit_vector.hpp"
+
+#include <doctest/doctest.h>
+
+#include "stronk/unit.hpp"
+#include "stronk/utilities/aligned_allocator.hpp"
+#include "stronk/utilities/ratio.hpp"
+
+namespace twig
+{
+
+struct vec_meters : stronk_default_unit<vec_meters, twig::ratio<1>>
+{
+};
+
+struct vec_seconds : stronk_default_unit<vec_seconds, twig::ratio<1>>
+{
+};
+
+using vec_speed = divided_unit_t<vec_meters, vec_seconds>;
+using vec_square_meters = multiplied_unit_t<vec_meters, vec_meters>;
+
+using meters_vector = unit_vector<vec_meters, double>;
+using seconds_vector = unit_vector<vec_seconds, double>;
+
+static_assert(unit_vector_like<meters_vector>);
+static_assert(!unit_vector_like<vec_meters::value<double>>);
+static_assert(std::same_as<meters_vector::value_type, vec_meters::value<double>>);
+static_assert(std::same_as<meters_vector::underlying_type, double>);
+static_assert(std::same_as<decltype(evaluate(meters_vector {} * meters_vector {})),
+                           unit_vector<vec_square_meters, double>>);
+static_assert(std::same_as<decltype(evaluate(meters_vector {} / seconds_vector {})), unit_vector<vec_speed, double>>);
+static_assert(std::same_as<decltype(evaluate(meters_vector {} / meters_vector {})),
+                           unit_vector<identity_unit, double>>);
+static_assert(std::same_as<decltype(evaluate(meters_vector {} * 2.0)), meters_vector>);
+static_assert(std::same_as<decltype(evaluate(1.0 / seconds_vector {})),
+                           unit_vector<divided_unit_t<identity_unit, vec_seconds>, double>>);
+
+// expressions are lazy, and only carry the resulting unit in their value_type
+static_assert(!unit_vector_like<decltype(meters_vector {} * meters_vector {})>);
+static_assert(unit_vector_expression_like<decltype(meters_vector {} * meters_vector {})>);
+static_assert(std::same_as<decltype(meters_vector {} / seconds_vector {} * seconds_vector {})::value_type,
+                           vec_meters::value<double>>);
+
+template<typename A, typename B>
+concept can_add_vectors = requires(A a, B b) {
+    a + b;
+    a += b;
+};
+static_assert(can_add_vectors<meters_vector, meters_vector>);
+
+struct vec_euros : stronk_default_unit<vec_euros, twig::ratio<1>>
+{
+};
+
+struct vec_megawatt_hours : stronk_default_unit<vec_megawatt_hours, twig::ratio<1>>
+{
+};
+
+using vec_euros_per_megawatt_hour = divided_unit_t<vec_euros, vec_megawatt_hours>;
+
+TEST_SUITE("unit_vector")
+{
+    TEST_CASE("elements_are_exposed_as_unit_values")
+    {
+        auto vec = meters_vector {vec_meters::value<double> {1.0}, vec_meters::value<double> {2.0}};
+        CHECK_EQ(vec.size(), 2);
+        CHECK_EQ(vec[0], vec_meters::value<double> {1.0});
+        CHECK_EQ(vec.at(1), vec_meters::value<double> {2.0});
+        CHECK_THROWS_AS((void)vec.at(2), std::out_of_range);
+
+        vec[0] = vec_meters::value<double> {5.0};
+        vec.push_back(vec_meters::value<double> {3.0});
+        CHECK_EQ(vec.size(), 3);
+
+        auto expected = std::array {5.0, 2.0, 3.0};
+        auto i = std::size_t {0};
+        for (const auto& val : vec) {
+            CHECK_EQ(val, vec_meters::value<double> {expected.at(i)});
+            i++;
+        }
+        CHECK_EQ(i, 3);
+    }
+
+    TEST_CASE("storage_is_simd_aligned")
+    {
+        auto vec = meters_vector(17);
+        const auto address = reinterpret_cast<std::uintptr_t>(vec.unwrap<meters_vector>().data());  // NOLINT
+        CHECK_EQ(address % stronk_details::simd_alignment, 0);
+    }
+
+    TEST_CASE("multiplying_vectors_multiplies_element_wise_into_the_multiplied_unit")
+    {
+        auto a = meters_vector(1000);
+        auto b = meters_vector(1000);
+        for (auto i = std::size_t {0}; i < a.size(); i++) {
+            a[i] = vec_meters::value<double> {static_cast<double>(i)};
+            b[i] = vec_meters::value<double> {static_cast<double>(i) * 0.5};
+        }
+
+        const auto res = a * b;
+        REQUIRE_EQ(res.size(), a.size());
+        for (auto i = std::size_t {0}; i < res.size(); i++) {
+            CHECK_EQ(res[i], std::as_const(a)[i] * std::as_const(b)[i]);
+        }
+    }
+
+    TEST_CASE("dividing_vectors_divides_element_wise_into_the_divided_unit")
+    {
+        auto distances = meters_vector {vec_meters::value<double> {10.0}, vec_meters::value<double> {9.0}};
+        auto times = seconds_vector {vec_seconds::value<double> {2.0}, vec_seconds::value<double> {3.0}};
+
+        const auto speeds = distances / times;
+        CHECK_EQ(speeds[0], make<vec_speed>(5.0));
+        CHECK_EQ(speeds[1], make<vec_speed>(3.0));
+
+        const auto ratios = distances / distances;
+        CHECK_EQ(ratios[0], 1.0);
+        CHECK_EQ(ratios[1], 1.0);
+    }
+
+    TEST_CASE("adding_and_subtracting_requires_the_same_unit")
+    {
+        auto a = meters_vector {vec_meters::value<double> {1.0}, vec_meters::value<double> {2.0}};
+        auto b = meters_vector {vec_meters::value<double> {3.0}, vec_meters::value<double> {5.0}};
+
+        const auto sum = a + b;
+        CHECK_EQ(sum[0], vec_meters::value<double> {4.0});
+        CHECK_EQ(sum[1], vec_meters::value<double> {7.0});
+
+        const auto diff = b - a;
+        CHECK_EQ(diff[0], vec_meters::value<double> {2.0});
+        CHECK_EQ(diff[1], vec_meters::value<double> {3.0});
+
+        a += b;
+        CHECK_EQ(a[1], vec_meters::value<double> {7.0});
+        a -= b;
+        CHECK_EQ(a[1], vec_meters::value<double> {2.0});
+
+        static_assert(!can_add_vectors<meters_vector, seconds_vector>);
+    }
+
+    TEST_CASE("scalars_and_unit_values_are_broadcast")
+    {
+        auto a = meters_vector {vec_meters::value<double> {1.0}, vec_meters::value<double> {2.0}};
+
+        const auto doubled = a * 2.0;
+        CHECK_EQ(doubled[1], vec_meters::value<double> {4.0});
+        const auto halved = a / 2.0;
+        CHECK_EQ(halved[1], vec_meters::value<double> {1.0});
+
+        const auto speeds = a / vec_seconds::value<double> {2.0};
+        CHECK_EQ(speeds[0], make<vec_speed>(0.5));
+
+        const auto shifted = vec_meters::value<double> {1.0} + a;
+        CHECK_EQ(shifted[1], vec_meters::value<double> {3.0});
+
+        a *= 3.0;
+        CHECK_EQ(a[0], vec_meters::value<double> {3.0});
+        a /= 3.0;
+        CHECK_EQ(a[0], vec_meters::value<double> {1.0});
+    }
+
+    TEST_CASE("mismatching_sizes_throws")
+    {
+        auto a = meters_vector(3);
+        auto b = meters_vector(4);
+        CHECK_THROWS_AS((void)(a * b), std::invalid_argument);
+        CHECK_THROWS_AS(a += b, std::invalid_argument);
+        CHECK_THROWS_AS((void)(a + a * 2.0 + b), std::invalid_argument);
+    }
+
+    TEST_CASE("expressions_are_evaluated_in_a_single_pass_on_assignment")
+    {
+        auto prices = unit_vector<vec_euros_per_megawatt_hour, double>(100);
+        auto volumes = unit_vector<vec_megawatt_hours, double>(100);
+        auto fees = unit_vector<vec_euros, double>(100);
+        for (auto i = std::size_t {0}; i < prices.size(); i++) {
+            prices[i] = make<vec_euros_per_megawatt_hour>(static_cast<double>(i));
+            volumes[i] = make<vec_megawatt_hours>(2.0);
+            fees[i] = make<vec_euros>(1.0);
+        }
+
+        const auto expression = prices * volumes + fees;
+        static_assert(std::same_as<decltype(expression)::value_type, vec_euros::value<double>>);
+        CHECK_EQ(expression.size(), 100);
+        CHECK_EQ(expression[3], make<vec_euros>(7.0));
+
+        const unit_vector<vec_euros, double> costs = expression;
+        REQUIRE_EQ(costs.size(), 100);
+        for (auto i = std::size_t {0}; i < costs.size(); i++) {
+            CHECK_EQ(costs[i], make<vec_euros>(static_cast<double>(i) * 2.0 + 1.0));
+        }
+
+        // assigning reuses the existing storage
+        using euros_vector = unit_vector<vec_euros, double>;
+        auto total = euros_vector(100);
+        const auto* storage = total.unwrap<euros_vector>().data();
+        total = prices * volumes - fees * 2.0;
+        CHECK_EQ(storage, total.unwrap<euros_vector>().data());
+        CHECK_EQ(total[10], make<vec_euros>(18.0));
+    }
+
+    TEST_CASE("expressions_can_refer_to_the_vector_they_are_assigned_to")
+    {
+        auto a = meters_vector {vec_meters::value<double> {1.0}, vec_meters::value<double> {2.0}};
+        auto b = meters_vector {vec_meters::value<double> {3.0}, vec_meters::value<double> {4.0}};
+
+        a = a + b * 2.0 - a / 2.0;
+        CHECK_EQ(a[0], vec_meters::value<double> {6.5});
+        CHECK_EQ(a[1], vec_meters::value<double> {9.0});
+
+        a += b - a;
+        CHECK_EQ(a[0], vec_meters::value<double> {3.0});
+        CHECK_EQ(a[1], vec_meters::value<double> {4.0});
+    }
+
+    TEST_CASE("expressions_take_ownership_of_temporaries")
+    {
+        auto make_vector = [](double value) { return meters_vector(8, vec_meters::value<double> {value}); };
+
+        const auto expression = make_vector(2.0) * make_vector(3.0);
+        const auto res = evaluate(expression);
+        CHECK_EQ(res.size(), 8);
+        CHECK_EQ(res[7], make<vec_square_meters>(6.0));
+    }
+}
+
+}  // namespace twig
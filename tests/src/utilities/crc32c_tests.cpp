@@ -0,0 +1,52 @@
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "stronk/utilities/crc32c.hpp"
+
+#include <doctest/doctest.h>
+
+namespace twig
+{
+
+namespace
+{
+
+constexpr auto as_bytes(std::string_view text) -> std::vector<std::byte>
+{
+    auto bytes = std::vector<std::byte> {};
+    for (auto c : text) {
+        bytes.push_back(static_cast<std::byte>(c));
+    }
+    return bytes;
+}
+
+}  // namespace
+
+// the check value of CRC32C
+static_assert(stronk_details::crc32c(as_bytes("123456789")) == 0xE3069283U);
+static_assert(stronk_details::crc32c(std::span<const std::byte> {}) == 0);
+
+TEST_SUITE("crc32c")
+{
+    TEST_CASE("runtime_checksums_match_the_constexpr_ones")
+    {
+        auto text = std::string_view {"the quick brown fox jumps over the lazy dog, 0123456789"};
+        for (auto size = std::size_t {0}; size <= text.size(); size++) {
+            const auto bytes = as_bytes(text.substr(0, size));
+            CHECK_EQ(stronk_details::crc32c(bytes), stronk_details::crc32c_software(bytes, ~0U) ^ ~0U);
+        }
+        CHECK_EQ(stronk_details::crc32c(as_bytes("123456789")), 0xE3069283U);
+    }
+
+    TEST_CASE("checksums_can_be_computed_in_parts")
+    {
+        const auto bytes = as_bytes("123456789");
+        const auto first = stronk_details::crc32c(std::span {bytes}.first(4));
+        CHECK_EQ(stronk_details::crc32c(std::span {bytes}.subspan(4), first), 0xE3069283U);
+    }
+}
+
+}  // namespace twig
@@ -1,4 +1,5 @@
 #include <concepts>
+#include <utility>
 
 #include <stronk/utilities/dimensions.hpp>
 
@@ -13,6 +14,10 @@ struct time
 {
 };
 
+struct mass
+{
+};
+
 using Distance = dimensions<dimension<distance, 1>>;
 using Time = dimensions<dimension<time, 1>>;
 using Speed = dimensions<dimension<distance, 1>, dimension<time, -1>>;
@@ -25,6 +30,28 @@ static_assert(std::same_as<create_dimensions_t<dimension<distance, 1>, dimension
 static_assert(std::same_as<create_dimensions_t<dimension<distance, 1>, dimension<distance, 1>>,
                            create_dimensions_t<dimension<distance, 2>>>);
 
+static_assert(std::same_as<create_dimensions_t<dimension<time, -2>, dimension<mass, 1>, dimension<distance, 1>>,
+                           create_dimensions_t<dimension<distance, 1>, dimension<mass, 1>, dimension<time, -2>>>);
+static_assert(
+    std::same_as<create_dimensions_t<dimension<time, 1>, dimension<distance, 1>, dimension<time, -1>>, Distance>);
+static_assert(std::same_as<create_dimensions_t<dimension<time, 1>, dimension<time, -1>>, empty_dimensions>);
+
+// distinct units with the same type key (two lambdas in one function have the same name) are not merged
+constexpr auto two_lambdas()
+{
+    auto first = []() {};
+    auto second = []() {};
+    return std::pair {first, second};
+}
+using first_lambda_unit = decltype(two_lambdas().first);
+using second_lambda_unit = decltype(two_lambdas().second);
+static_assert(!std::same_as<first_lambda_unit, second_lambda_unit>);
+static_assert(create_dimensions_t<dimension<first_lambda_unit, 1>, dimension<second_lambda_unit, -1>>::size() == 2);
+static_assert(std::same_as<create_dimensions_t<dimension<first_lambda_unit, 1>,
+                                               dimension<second_lambda_unit, -1>,
+                                               dimension<first_lambda_unit, 1>>,
+                           create_dimensions_t<dimension<first_lambda_unit, 2>, dimension<second_lambda_unit, -1>>>);
+
 // multiply
 static_assert(std::same_as<empty_dimensions::multiply_t<empty_dimensions>, empty_dimensions>);
 static_assert(std::same_as<Distance::multiply_t<Distance::negate_t>, empty_dimensions>);
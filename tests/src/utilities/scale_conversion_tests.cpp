@@ -0,0 +1,139 @@
+#include <cstdint>
+#include <limits>
+
+#include "stronk/utilities/scale_conversion.hpp"
+
+#include <doctest/doctest.h>
+
+#include "stronk/utilities/ratio.hpp"
+
+namespace twig
+{
+
+// Folding policies passed to scale_converter, rather than specializing scale_folding_policy
+template<typename T>
+struct a_folding_policy
+{
+    constexpr static unsigned max_ulp = 1;
+};
+
+template<typename T>
+struct an_exact_folding_policy
+{
+    constexpr static unsigned max_ulp = 0;
+};
+
+// Opts in to folding inexact factors for long double, which nothing else in the tests converts
+template<>
+struct stronk_details::scale_folding_policy<long double>
+{
+    constexpr static unsigned max_ulp = 1;
+};
+
+static_assert(stronk_details::scale_converter<kilo, ratio<1>, int>::apply(3) == 3000);
+static_assert(stronk_details::scale_converter<ratio<1>, kilo, int>::apply(3999) == 3);
+static_assert(stronk_details::scale_converter<ratio<1>, kilo, int>::apply(-3999) == -3);
+static_assert(stronk_details::scale_converter<ratio<1>, ratio<1>, int>::is_identity);
+static_assert(stronk_details::scale_converter<kilo, ratio<1>, double>::factor() == 1000.0);
+static_assert(stronk_details::scale_converter<kilo, ratio<1>, double>::factor_is_exact());
+static_assert(stronk_details::scale_converter<ratio<1>, ratio<4>, float>::factor_is_exact());
+static_assert(!stronk_details::scale_converter<ratio<1>, kilo, double>::factor_is_exact());
+static_assert(!stronk_details::scale_converter<ratio<1>, kilo, double>::is_folded());  // only exact factors by default
+static_assert(stronk_details::scale_converter<ratio<1>, kilo, long double>::is_folded());  // opted in above
+static_assert(stronk_details::scale_converter<ratio<1>, kilo, double, a_folding_policy>::is_folded());
+static_assert(!stronk_details::scale_converter<ratio<1>, kilo, long double, an_exact_folding_policy>::is_folded());
+static_assert(stronk_details::is_exactly_representable<float>(1ULL << 40U));
+static_assert(!stronk_details::is_exactly_representable<float>((1ULL << 24U) + 1));
+static_assert(stronk_details::is_exactly_representable<double>((1ULL << 24U) + 1));
+
+namespace
+{
+
+// Compares the converter with a widened `value * num / den` for every value of T
+template<typename FromScaleT, typename ToScaleT, typename T>
+void check_all_values_against_widened_reference()
+{
+    using converter = stronk_details::scale_converter<FromScaleT, ToScaleT, T>;
+    using ratio_t = ratio_divide<FromScaleT, ToScaleT>;
+    for (auto wide = static_cast<int64_t>(std::numeric_limits<T>::min());
+         wide <= static_cast<int64_t>(std::numeric_limits<T>::max());
+         wide++)
+    {
+        const auto expected = wide * static_cast<int64_t>(ratio_t::num) / static_cast<int64_t>(ratio_t::den);
+        const auto expect_overflow = expected > static_cast<int64_t>(std::numeric_limits<T>::max())
+            || expected < static_cast<int64_t>(std::numeric_limits<T>::min());
+
+        auto overflowed = false;
+        const auto res = converter::apply(static_cast<T>(wide), overflowed);
+        REQUIRE_EQ(overflowed, expect_overflow);
+        if (!expect_overflow) {
+            REQUIRE_EQ(static_cast<int64_t>(res), expected);
+        }
+    }
+}
+
+}  // namespace
+
+TEST_SUITE("scale_converter")
+{
+    TEST_CASE("integers_are_converted_exactly_with_overflow_detection")
+    {
+        check_all_values_against_widened_reference<ratio<1>, ratio<1, 3>, int8_t>();
+        check_all_values_against_widened_reference<ratio<1>, ratio<3>, int8_t>();
+        check_all_values_against_widened_reference<ratio<5>, ratio<18>, int8_t>();
+        check_all_values_against_widened_reference<ratio<18>, ratio<5>, int8_t>();
+        check_all_values_against_widened_reference<ratio<18>, ratio<5>, uint8_t>();
+        check_all_values_against_widened_reference<ratio<7>, ratio<3>, int16_t>();
+        check_all_values_against_widened_reference<ratio<1000>, ratio<3600>, int16_t>();
+        check_all_values_against_widened_reference<ratio<3600>, ratio<1000>, uint16_t>();
+    }
+
+    TEST_CASE("ratio_components_of_the_magnitude_of_the_minimum_convert_exactly")
+    {
+        check_all_values_against_widened_reference<ratio<1>, ratio<128>, int8_t>();
+        check_all_values_against_widened_reference<ratio<128>, ratio<1>, int8_t>();
+        check_all_values_against_widened_reference<ratio<1>, ratio<32768>, int16_t>();
+        check_all_values_against_widened_reference<ratio<32768>, ratio<1>, int16_t>();
+        check_all_values_against_widened_reference<ratio<1>, ratio<256>, uint8_t>();
+        check_all_values_against_widened_reference<ratio<256>, ratio<1>, uint8_t>();
+    }
+
+    TEST_CASE("ratios_larger_than_the_type_overflow_for_any_none_zero_value")
+    {
+        using converter = stronk_details::scale_converter<mega, ratio<1>, int16_t>;
+        auto overflowed = false;
+        CHECK_EQ(converter::apply(int16_t {0}, overflowed), 0);
+        CHECK_FALSE(overflowed);
+        (void)converter::apply(int16_t {-1}, overflowed);
+        CHECK(overflowed);
+
+        using down_converter = stronk_details::scale_converter<ratio<1>, mega, int16_t>;
+        CHECK_EQ(down_converter::apply(int16_t {32000}), 0);
+    }
+
+    TEST_CASE("floating_points_multiply_by_exact_factors_and_divide_by_inexact_ones")
+    {
+        using converter = stronk_details::scale_converter<ratio<1>, ratio<4>, double>;
+        CHECK_EQ(converter::factor(), 0.25);
+        CHECK_EQ(converter::apply(3.0), 0.75);
+
+        // 3.0 * 0.1 would be 0.30000000000000004
+        using inexact_converter = stronk_details::scale_converter<deci, ratio<1>, double>;
+        CHECK_EQ(inexact_converter::apply(3.0), 0.3);
+        CHECK_EQ(inexact_converter::apply(3.0), 3.0 * 1.0 / 10.0);
+
+        using opted_in_converter = stronk_details::scale_converter<kilo, mega, long double>;
+        CHECK_EQ(opted_in_converter::apply(1500.0L), 1500.0L * opted_in_converter::factor());
+    }
+
+    TEST_CASE("integer_ratios_which_need_widening_are_spelled_out_when_not_checking_overflow")
+    {
+        // (201 - 1) * 200 does not fit in int16_t, so `value * num / den` is used as is
+        using converter = stronk_details::scale_converter<ratio<200>, ratio<201>, int16_t>;
+        static_assert(!stronk_details::integral_scale_converter<int16_t, 200, 201>::is_exact_without_widening);
+        CHECK_EQ(converter::apply(int16_t {0}), 0);
+        CHECK_EQ(converter::apply(int16_t {100}), 99);
+    }
+}
+
+}  // namespace twig
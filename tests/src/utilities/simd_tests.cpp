@@ -0,0 +1,134 @@
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "stronk/utilities/simd.hpp"
+
+#include <doctest/doctest.h>
+
+#include "stronk/cmath.hpp"
+#include "stronk/unit.hpp"
+#include "stronk/utilities/ratio.hpp"
+
+#if __has_include(<experimental/simd>)
+#    include <experimental/simd>
+#endif
+
+namespace twig
+{
+
+static_assert(!simd_like<double>);
+static_assert(std::same_as<simd_scalar_t<double>, double>);
+
+// libc++ ships an incomplete <experimental/simd> (no math functions), so only test the complete implementations
+#if defined(__cpp_lib_experimental_parallel_simd)
+
+namespace stdx = std::experimental;
+
+using double_simd = stdx::native_simd<double>;
+
+static_assert(simd_like<double_simd>);
+static_assert(std::same_as<simd_scalar_t<double_simd>, double>);
+
+struct simd_meters : stronk_default_unit<simd_meters, twig::ratio<1>>
+{
+};
+
+struct simd_seconds : stronk_default_unit<simd_seconds, twig::ratio<1>>
+{
+};
+
+using simd_kilo_meters = simd_meters::scaled_t<twig::kilo>;
+
+namespace
+{
+
+auto iota_simd(double start) -> double_simd
+{
+    return double_simd([start](auto i) { return start + static_cast<double>(i); });
+}
+
+}  // namespace
+
+TEST_SUITE("simd")
+{
+    TEST_CASE("multiplying_and_dividing_simd_unit_values_keeps_the_dimensions")
+    {
+        const auto distances = make<simd_meters>(iota_simd(1.0) * 10.0);
+        const auto times = make<simd_seconds>(double_simd(2.0));
+
+        const auto speeds = distances / times;
+        static_assert(
+            std::same_as<decltype(speeds), const unit_value_t<divided_unit_t<simd_meters, simd_seconds>, double_simd>>);
+        static_assert(std::same_as<decltype(speeds * times), unit_value_t<simd_meters, double_simd>>);
+
+        const auto expected = make<divided_unit_t<simd_meters, simd_seconds>>(iota_simd(1.0) * 5.0);
+        CHECK(stdx::all_of(speeds == expected));
+        CHECK(stdx::all_of(speeds * times == distances));
+
+        const auto scaled = distances * 2.0;
+        CHECK(stdx::all_of(scaled == make<simd_meters>(iota_simd(1.0) * 20.0)));
+    }
+
+    TEST_CASE("converting_scale_of_simd_unit_values")
+    {
+        const auto meters = make<simd_meters>(iota_simd(1.0) * 1000.0);
+        const auto kilo_meters = meters.to<simd_kilo_meters>();
+        CHECK(stdx::all_of(kilo_meters == make<simd_kilo_meters>(iota_simd(1.0))));
+        CHECK(stdx::all_of(kilo_meters.to<simd_meters>() == meters));
+    }
+
+    TEST_CASE("comparisons_of_simd_unit_values_return_masks")
+    {
+        const auto a = make<simd_meters>(iota_simd(0.0));
+        const auto b = make<simd_meters>(double_simd(1.0));
+
+        const auto less = a < b;
+        static_assert(std::same_as<std::remove_cvref_t<decltype(less)>, double_simd::mask_type>);
+        CHECK(less[0]);
+        CHECK_EQ(stdx::popcount(less), 1);
+        CHECK_EQ(stdx::popcount(a <= b), 2);
+        CHECK_EQ(stdx::popcount(a > b), static_cast<int>(double_simd::size()) - 2);
+        CHECK_EQ(stdx::popcount(a >= b), static_cast<int>(double_simd::size()) - 1);
+
+        // equality is still within a tolerance lane-wise
+        CHECK(stdx::all_of(a == make<simd_meters>(iota_simd(0.0) + 1e-12)));
+        CHECK_EQ(stdx::popcount(a == b), 1);
+    }
+
+    TEST_CASE("sqrt_and_pow_of_simd_unit_values")
+    {
+        const auto lengths = make<simd_meters>(iota_simd(1.0));
+
+        const auto areas = twig::pow<2>(lengths);
+        static_assert(std::same_as<decltype(areas), const unit_value_t<multiplied_unit_t<simd_meters, simd_meters>,
+                                                                        double_simd>>);
+        CHECK(stdx::all_of(areas == lengths * lengths));
+
+        const auto roots = twig::sqrt(areas);
+        static_assert(std::same_as<decltype(roots), const unit_value_t<simd_meters, double_simd>>);
+        CHECK(stdx::all_of(roots == lengths));
+    }
+
+    TEST_CASE("simd_unit_values_can_be_loaded_and_stored")
+    {
+        auto raw = std::vector<double>(double_simd::size() * 2);
+        for (auto i = std::size_t {0}; i < raw.size(); i++) {
+            raw[i] = static_cast<double>(i);
+        }
+
+        auto sum = make<simd_meters>(double_simd(0.0));
+        for (auto i = std::size_t {0}; i < raw.size(); i += double_simd::size()) {
+            sum += make<simd_meters>(double_simd(&raw[i], stdx::element_aligned));
+        }
+
+        auto out = std::vector<double>(double_simd::size());
+        sum.unwrap<unit_value_t<simd_meters, double_simd>>().copy_to(out.data(), stdx::element_aligned);
+        CHECK_EQ(out[0], static_cast<double>(double_simd::size()));
+    }
+}
+
+#endif
+
+}  // namespace twig
@@ -0,0 +1,240 @@
+"""
+Compile time benchmarks for the stronk headers.
+
+Generates translation units with N base units, M units composed of those, and K skills per unit. Each translation
+unit is compiled a number of times, recording the wall time and peak memory of the compiler. With clang the
+instantiation counts are read from `-ftime-trace`, with gcc the template instantiation time is read from
+`-ftime-report`. The results are written as a JSON summary.
+
+Example:
+  python3 tools/compile_benchmarks.py --compiler clang++ --include-dirs ./include --output compile_benchmarks.json
+"""
+
+import argparse
+import itertools
+import json
+import os
+import platform
+import random
+import re
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+from dataclasses import asdict, dataclass, field
+from pathlib import Path
+from typing import List, Optional
+
+# (skill, header providing it), in the order they are added to the units
+SKILLS = [
+    ("twig::can_add", "stronk/stronk.hpp"),
+    ("twig::can_subtract", "stronk/stronk.hpp"),
+    ("twig::can_negate", "stronk/stronk.hpp"),
+    ("twig::can_order", "stronk/stronk.hpp"),
+    ("twig::can_equate_underlying_type_specific", "stronk/stronk.hpp"),
+    ("twig::can_abs", "stronk/skills/can_abs.hpp"),
+    ("twig::can_isnan", "stronk/skills/can_isnan.hpp"),
+    ("twig::can_increment", "stronk/skills/can_increment.hpp"),
+    ("twig::can_decrement", "stronk/skills/can_decrement.hpp"),
+    ("twig::can_ostream", "stronk/skills/can_stream.hpp"),
+]
+
+
+@dataclass
+class Configuration:
+    units: int
+    dimensions: int
+    skills: int
+
+
+@dataclass
+class Measurement:
+    wall_seconds: float
+    peak_memory_kib: int
+    instantiations: Optional[int] = None
+    instantiation_seconds: Optional[float] = None
+
+
+@dataclass
+class Result:
+    configuration: Configuration
+    measurements: List[Measurement] = field(default_factory=list)
+
+    def summary(self) -> dict:
+        def median_of(name: str):
+            values = [getattr(x, name) for x in self.measurements if getattr(x, name) is not None]
+            return statistics.median_low(values) if values else None
+
+        return {
+            **asdict(self.configuration),
+            "wall_seconds": median_of("wall_seconds"),
+            "peak_memory_kib": median_of("peak_memory_kib"),
+            "instantiations": median_of("instantiations"),
+            "instantiation_seconds": median_of("instantiation_seconds"),
+            "runs": [asdict(x) for x in self.measurements],
+        }
+
+
+def generate_translation_unit(config: Configuration, seed: int) -> str:
+    """
+    Returns the source of a translation unit with the given number of units, composed units and skills.
+    Composed units multiply and divide 2 to 4 randomly picked base units, and are instantiated through functions using
+    the unit operators.
+    """
+    skills = SKILLS[: config.skills]
+    headers = sorted({"stronk/unit.hpp"} | {header for _, header in skills})
+
+    lines = [f'#include "{header}"' for header in headers]
+    lines += ["", "namespace compile_benchmark", "{", ""]
+
+    skill_list = "".join(f", {skill}" for skill, _ in skills)
+    for i in range(config.units):
+        lines.append(f"struct unit_{i} : twig::unit<unit_{i}, twig::ratio<1>{skill_list}>")
+        lines.append("{")
+        lines.append("};")
+        lines.append("")
+
+    rng = random.Random(seed)
+    for i in range(config.dimensions):
+        factors = [rng.randrange(config.units) for _ in range(rng.randint(2, 4))]
+        divides = [rng.random() < 0.5 for _ in factors[1:]]
+
+        unit_expression = f"unit_{factors[0]}"
+        value_expression = "v0"
+        for index, (factor, divide) in enumerate(zip(factors[1:], divides), start=1):
+            alias = "twig::divided_unit_t" if divide else "twig::multiplied_unit_t"
+            unit_expression = f"{alias}<{unit_expression}, unit_{factor}>"
+            value_expression = f"({value_expression} {'/' if divide else '*'} v{index})"
+
+        parameters = ", ".join(
+            f"twig::unit_value_t<unit_{factor}, double> v{index}" for index, factor in enumerate(factors)
+        )
+        lines.append(f"using composed_{i} = {unit_expression};")
+        lines.append(f"auto compose_{i}({parameters}) -> twig::unit_value_t<composed_{i}, double>")
+        lines.append("{")
+        lines.append(f"    return {value_expression};")
+        lines.append("}")
+        lines.append("")
+
+    lines += ["}  // namespace compile_benchmark", ""]
+    return "\n".join(lines)
+
+
+def is_clang(compiler: str) -> bool:
+    version = subprocess.run([compiler, "--version"], capture_output=True, text=True, check=True).stdout
+    return "clang" in version
+
+
+def count_instantiations(time_trace: Path) -> tuple[int, float]:
+    """
+    Returns the number of class and function instantiations and their total time from a clang -ftime-trace file
+    """
+    with open(time_trace, "r", encoding="utf-8") as f:
+        events = json.load(f)["traceEvents"]
+
+    instantiations = 0
+    total_microseconds = 0
+    for event in events:
+        if event.get("name") in ("InstantiateClass", "InstantiateFunction") and event.get("ph") == "X":
+            instantiations += 1
+        elif event.get("name") in ("Total InstantiateClass", "Total InstantiateFunction"):
+            total_microseconds += event.get("dur", 0)
+    return instantiations, total_microseconds / 1e6
+
+
+def template_instantiation_seconds(time_report: str) -> Optional[float]:
+    """
+    Returns the wall time of the template instantiation phase from a gcc -ftime-report output
+    """
+    match = re.search(r"^\s*template instantiation\s*:.*?([\d.]+)\s*\(\s*\d+%\)\s*[\d.]+[kMG]?\s*\(", time_report, re.M)
+    return float(match.group(1)) if match else None
+
+
+def compile_once(args: argparse.Namespace, clang: bool, source: Path) -> Measurement:
+    output = source.with_suffix(".o")
+    command = [args.compiler, f"-std={args.std}", *args.flags.split(), "-c", str(source), "-o", str(output)]
+    command += [f"-I{x}" for x in args.include_dirs]
+    # a granularity of 0 records every instantiation, rather than only the slow ones
+    command += ["-ftime-trace", "-ftime-trace-granularity=0"] if clang else ["-ftime-report"]
+
+    stderr_path = source.with_suffix(".stderr")
+    with open(stderr_path, "w", encoding="utf-8") as stderr_file:
+        start = time.perf_counter()
+        process = subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=stderr_file)
+        # wait4 gives the resource usage of this compilation only (including the processes spawned by the driver)
+        _, status, usage = os.wait4(process.pid, 0)
+        wall_seconds = time.perf_counter() - start
+        process.returncode = os.waitstatus_to_exitcode(status)
+    stderr = stderr_path.read_text(encoding="utf-8")
+    if process.returncode != 0:
+        sys.exit(f"compilation of {source} failed:\n{stderr}")
+
+    # ru_maxrss is in bytes on macOS, and KiB elsewhere
+    peak_memory_kib = usage.ru_maxrss // 1024 if platform.system() == "Darwin" else usage.ru_maxrss
+    measurement = Measurement(wall_seconds=wall_seconds, peak_memory_kib=peak_memory_kib)
+    if clang:
+        measurement.instantiations, measurement.instantiation_seconds = count_instantiations(output.with_suffix(".json"))
+    else:
+        measurement.instantiation_seconds = template_instantiation_seconds(stderr)
+    return measurement
+
+
+def parse_args() -> argparse.Namespace:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"), help="the c++ compiler to benchmark")
+    parser.add_argument("--include-dirs", nargs="+", required=True, help="include directories of stronk")
+    parser.add_argument("--output", type=Path, required=True, help="where to write the JSON summary")
+    parser.add_argument("--std", default="c++20", help="the c++ standard to compile with")
+    parser.add_argument("--flags", default="-O0", help="extra flags for the compiler, separated by spaces")
+    parser.add_argument("--units", type=int, nargs="+", default=[4, 32], help="numbers of base units")
+    parser.add_argument("--dimensions", type=int, nargs="+", default=[16, 128], help="numbers of composed units")
+    parser.add_argument("--skills", type=int, nargs="+", default=[0, 5, len(SKILLS)], help="numbers of skills")
+    parser.add_argument("--repetitions", type=int, default=3, help="compilations of each translation unit")
+    parser.add_argument("--seed", type=int, default=42, help="seed for picking the units which are composed")
+    parser.add_argument("--keep-sources", type=Path, help="keep the generated translation units in this directory")
+    return parser.parse_args()
+
+
+def main() -> None:
+    args = parse_args()
+    if any(x > len(SKILLS) for x in args.skills):
+        sys.exit(f"at most {len(SKILLS)} skills are supported")
+    if any(x < 1 for x in args.units):
+        sys.exit("at least 1 unit is needed")
+
+    clang = is_clang(args.compiler)
+    results = []
+    with tempfile.TemporaryDirectory() as temp_dir:
+        work_dir = args.keep_sources or Path(temp_dir)
+        work_dir.mkdir(parents=True, exist_ok=True)
+
+        for units, dimensions, skills in itertools.product(args.units, args.dimensions, args.skills):
+            config = Configuration(units=units, dimensions=dimensions, skills=skills)
+            source = work_dir / f"units_{units}_dimensions_{dimensions}_skills_{skills}.cpp"
+            source.write_text(generate_translation_unit(config, args.seed), encoding="utf-8")
+
+            result = Result(configuration=config)
+            for _ in range(args.repetitions):
+                result.measurements.append(compile_once(args, clang, source))
+            results.append(result.summary())
+            print(
+                f"units={units} dimensions={dimensions} skills={skills}: "
+                f"{results[-1]['wall_seconds']:.3f}s, {results[-1]['peak_memory_kib']} KiB"
+            )
+
+    summary = {
+        "compiler": args.compiler,
+        "compiler_version": subprocess.run(
+            [args.compiler, "--version"], capture_output=True, text=True, check=True
+        ).stdout.splitlines()[0],
+        "flags": f"-std={args.std} {args.flags}",
+        "results": results,
+    }
+    args.output.parent.mkdir(parents=True, exist_ok=True)
+    args.output.write_text(json.dumps(summary, indent=2) + "\n", encoding="utf-8")
+    print(f"wrote {args.output}")
+
+
+if __name__ == "__main__":
+    main()